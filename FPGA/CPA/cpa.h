@@ -0,0 +1,310 @@
+/* CPA on Kuznyechik power traces : declarations shared by kuz_cpa and its engines. */
+
+#ifndef _CPA_H_
+#define _CPA_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+#define CPA_BYTES   16
+#define CPA_GUESSES 256
+#define CPA_HYPS    (CPA_BYTES*CPA_GUESSES)   // hypothesis h = byte*256 + guess
+
+/*****************************************************************************/
+/* Traces (traces.cpp)                                                       */
+/*****************************************************************************/
+
+typedef enum
+{
+  SAMPLE_INT8,
+  SAMPLE_INT16,
+  SAMPLE_FLOAT32,
+  SAMPLE_FLOAT64
+} sample_type_t;
+
+// One .npy file or trace store, mapped read-only. Sample value = raw * gain
+// + offset (1 and 0 for .npy).
+typedef struct
+{
+  sample_type_t  type;
+  size_t         rows;
+  size_t         samples;
+  size_t         stride;   // bytes from a row to the next
+  double         gain;
+  double         offset;
+  const uint8_t* data;     // first sample of the first row
+  void*          map;
+  size_t         mapLen;
+} trace_file_t;
+
+// The traces of a campaign : the rows of its files one after the other, and
+// the plaintext / ciphertext of every trace, 16 bytes each in a record of
+// metaStride bytes : in pairs (parsed from clair_chiffre.txt), in a mapped
+// pairs file or in the mapped trace store.
+typedef struct
+{
+  std::vector<trace_file_t> files;
+  size_t traces;
+  size_t samples;
+  const uint8_t* meta;       // pt of trace t at meta + t*metaStride, ct after it
+  size_t metaStride;
+  size_t metaCount;
+  std::vector<uint8_t> pairs;
+  void* metaMap;             // pairs file
+  size_t metaMapLen;
+} trace_set_t;
+
+// Pairs file : the binary clair_chiffre.txt. A 32-byte header, then one
+// 32-byte record per trace (pt then ct), record t for trace t; the number of
+// records comes from the file size, so it only grows by appending.
+#define PAIRS_MAGIC   "KUZPAIRS"
+#define PAIRS_VERSION 1
+#define PAIRS_RECORD  (2*CPA_BYTES)
+
+typedef struct
+{
+  char     magic[8];
+  uint32_t version;
+  uint32_t recordSize;   // PAIRS_RECORD
+  uint8_t  reserved[16];
+} pairs_header_t;
+
+// Bytes per sample, by sample_type_t
+extern const size_t trace_sample_size[];
+
+// Empty set
+void trace_init(trace_set_t* set);
+
+// Each returns 0, or -1 after a message on stderr. trace_open takes a .npy
+// file or a trace store (which brings its own pt / ct, and must be alone).
+int trace_open(trace_set_t* set, const char* name);
+int trace_open_npy(trace_set_t* set, const char* name);
+int trace_open_store(trace_set_t* set, const char* name);
+// A pairs file (mapped) or clair_chiffre.txt (parsed)
+int trace_load_pairs(trace_set_t* set, const char* name);
+void trace_close(trace_set_t* set);
+
+// Rows first..first+n-1 as doubles, n x samples
+void trace_rows(const trace_set_t* set, size_t first, size_t n, double* out);
+
+/*****************************************************************************/
+/* Trace store (store.cpp)                                                   */
+/*****************************************************************************/
+
+// One file per campaign, appendable while it is read :
+//
+//   header       4096 bytes, store_header_t
+//   records      one per trace, recordSize bytes (a multiple of 64) :
+//                pt[16] ct[16] key[16] reserved[16], then the raw samples
+//
+// 'traces' counts the complete records; it is updated after they are
+// written, so a reader never sees a partial one.
+
+#define STORE_MAGIC   "KUZSTORE"
+#define STORE_VERSION 1
+#define STORE_HEADER  4096
+#define STORE_META    64
+
+typedef struct
+{
+  char     magic[8];
+  uint32_t version;
+  uint32_t type;         // sample_type_t
+  uint64_t samples;
+  uint64_t traces;
+  uint64_t recordSize;
+  double   gain;
+  double   offset;
+} store_header_t;
+
+typedef struct
+{
+  int            fd;
+  store_header_t h;
+  std::vector<uint8_t> buf;
+} trace_store_t;
+
+// 1 if h is a STORE_VERSION header of a known sample type whose records
+// hold the metadata and the samples, 0 otherwise. Used by every reader and
+// by store_open_append.
+int store_header_ok(const store_header_t* h);
+
+// Each returns 0, or -1 after a message on stderr
+int store_create(trace_store_t* st, const char* name, sample_type_t type, size_t samples,
+                 double gain, double offset);
+int store_open_append(trace_store_t* st, const char* name);
+
+// n traces : pt, ct, key (NULL : zeros) 16 bytes each per trace, raw samples
+// in the type of the store, n x samples
+int store_append(trace_store_t* st, size_t n, const uint8_t* pt, const uint8_t* ct,
+                 const uint8_t* key, const void* raw);
+int store_close(trace_store_t* st);
+
+// n records of pt[16] ct[16] in a new pairs file
+int pairs_write(const char* name, const uint8_t* rec, size_t n);
+
+/*****************************************************************************/
+/* Leakage models (cpa.cpp)                                                  */
+/*****************************************************************************/
+
+// The hypothesis of byte b under guess k is hyp[d][k], d = byte b of the
+// plaintext or of the ciphertext of the trace
+typedef struct
+{
+  const char* name;
+  int         useCt;
+  uint8_t     hyp[256][CPA_GUESSES];
+} cpa_model_t;
+
+// "ct"       HW(ct[b] ^ k), last AddRoundKey (grasshopper_cpa.py)
+// "sbox"     HW(S(pt[b] ^ k)), first S step
+// "sbox-hd"  HW(S(pt[b] ^ k) ^ pt[b] ^ k), first S step written in place
+int cpa_model_init(cpa_model_t* model, const char* name);
+
+// Data byte b of trace t for this model
+static inline uint8_t cpa_data(const trace_set_t* set, const cpa_model_t* model, size_t t, int b)
+{
+  return set->meta[t*set->metaStride + (model->useCt ? CPA_BYTES : 0) + b];
+}
+
+/*****************************************************************************/
+/* Results (cpa.cpp)                                                         */
+/*****************************************************************************/
+
+typedef struct
+{
+  size_t traces;
+  size_t samples;
+  std::vector<double> r;                      // CPA_HYPS x samples, Pearson
+  double maxabs[CPA_BYTES][CPA_GUESSES];      // max |r| over the samples
+  size_t peak[CPA_BYTES][CPA_GUESSES];        // where
+} cpa_result_t;
+
+// maxabs / peak from r
+void cpa_peaks(cpa_result_t* res);
+
+// Best guess of every byte; pge[b] = guesses scoring above key[b] (if key)
+void cpa_rank(const cpa_result_t* res, const uint8_t* key, uint8_t* best, int* pge);
+
+/*****************************************************************************/
+/* One-pass engine (cpa_onepass.cpp)                                         */
+/*****************************************************************************/
+
+// Running sums of every hypothesis against every sample. The traces are
+// shifted by the mean of the first block first (Pearson does not change,
+// the sums stay small).
+typedef struct
+{
+  size_t n;
+  size_t samples;
+  std::vector<double> shift;    // samples
+  double sh[CPA_HYPS];
+  double sh2[CPA_HYPS];
+  std::vector<double> st;       // samples
+  std::vector<double> st2;      // samples
+  std::vector<double> sht;      // CPA_HYPS x samples
+} cpa_sums_t;
+
+void cpa_sums_init(cpa_sums_t* sums, const trace_set_t* set);
+
+// Adds traces first..first+n-1, each read once, threads splitting the
+// hypotheses
+void cpa_onepass(cpa_sums_t* sums, const trace_set_t* set, const cpa_model_t* model,
+                 size_t first, size_t n, unsigned threads);
+
+// Pearson matrix of the traces added so far
+void cpa_pearson(const cpa_sums_t* sums, cpa_result_t* res);
+
+/*****************************************************************************/
+/* GEMM engine (cpa_gemm.cpp)                                                */
+/*****************************************************************************/
+
+// Two passes over traces first..first+n-1, as grasshopper_cpa.py : the means,
+// then the centered numerators of all hypotheses as one blocked matrix
+// product, threads splitting the hypotheses
+void cpa_gemm(const trace_set_t* set, const cpa_model_t* model, size_t first, size_t n,
+              unsigned threads, cpa_result_t* res);
+
+/*****************************************************************************/
+/* Conditional-averaging engine (cpa_classes.cpp)                            */
+/*****************************************************************************/
+
+// Sum and count of the traces for each value of each data byte, the traces
+// shifted as in cpa_sums_t. Valid for any model of the same data (ct or pt).
+typedef struct
+{
+  size_t n;
+  size_t samples;
+  std::vector<double> shift;    // samples
+  double count[CPA_BYTES][256];
+  std::vector<double> st;       // samples
+  std::vector<double> st2;      // samples
+  std::vector<double> sum;      // CPA_BYTES x 256 x samples
+} cpa_classes_t;
+
+void cpa_classes_init(cpa_classes_t* cls, const trace_set_t* set);
+
+// Adds traces first..first+n-1, threads splitting the bytes
+void cpa_classes_add(cpa_classes_t* cls, const trace_set_t* set, const cpa_model_t* model,
+                     size_t first, size_t n, unsigned threads);
+
+// Adds trace t, its samples in row
+void cpa_classes_add_row(cpa_classes_t* cls, const trace_set_t* set, const cpa_model_t* model,
+                         size_t t, const double* row);
+
+// Pearson matrix of the traces added so far, independent of their number
+void cpa_classes_pearson(const cpa_classes_t* cls, const cpa_model_t* model, unsigned threads,
+                         cpa_result_t* res);
+
+/*****************************************************************************/
+/* Guessing entropy curves (cpa_curve.cpp)                                   */
+/*****************************************************************************/
+
+// PGE of every byte after step, 2 step, ... traces (and n), in one pass of
+// the conditional-averaging engine. With runs > 1, bootstrap : every run
+// draws its n traces from the first n with replacement, threads splitting
+// the runs.
+typedef struct
+{
+  int runs;
+  std::vector<size_t> traces;     // checkpoints
+  std::vector<double> pge;        // checkpoints x CPA_BYTES, mean over the runs
+  std::vector<double> success;    // checkpoints x CPA_BYTES, fraction of runs with pge 0
+} cpa_curve_t;
+
+void cpa_curve(const trace_set_t* set, const cpa_model_t* model, const uint8_t* key, size_t n,
+               size_t step, int runs, unsigned threads, cpa_curve_t* curve);
+
+/*****************************************************************************/
+/* Full-key rank and enumeration (cpa_key.cpp)                               */
+/*****************************************************************************/
+
+// Log-likelihood of every guess : (n - 3) atanh(max |r|)^2 / 2. The score of
+// a 128-bit key is the sum of the scores of its bytes.
+void cpa_scores(const cpa_result_t* res, double score[CPA_BYTES][CPA_GUESSES]);
+
+// log2 of the bounds of the rank of key (1 : best) among the 2^128 keys, by
+// convolution of per-byte score histograms of bins bins
+void cpa_key_rank(const double score[CPA_BYTES][CPA_GUESSES], const uint8_t* key, int bins,
+                  double* lo, double* hi);
+
+// Known plaintext / ciphertext test of a candidate round key. The other key
+// of its pair of the key schedule gives all the round keys : K9 for a K10
+// candidate (last = 1, ct model), K2 for a K1 candidate (last = 0).
+typedef struct
+{
+  uint8_t pt[CPA_BYTES];
+  uint8_t ct[CPA_BYTES];
+  uint8_t half[CPA_BYTES];
+  int last;
+} cpa_check_t;
+
+// Enumerates up to max round keys by decreasing score, threads checking
+// them by batches with chk, until one passes (round key in found, 32-byte
+// master key in master). Without chk, until the candidate is key : its
+// exact rank. Returns the 1-based position of the key found, 0 if none.
+size_t cpa_enumerate(const double score[CPA_BYTES][CPA_GUESSES], size_t max, const cpa_check_t* chk,
+                     const uint8_t* key, unsigned threads, uint8_t* found, uint8_t* master);
+
+#endif //_CPA_H_
@@ -0,0 +1,238 @@
+/* Conditional-averaging CPA : the traces summed per value of each data byte. */
+
+/*
+
+Every model of cpa.h predicts h = hyp[d][k] from the data byte d alone
+(ct[b] or pt[b]). So, with c(d) the traces whose byte b is d, n(d) their
+count and T(d) their sum :
+
+  sum(h)   = sum over d of n(d) hyp[d][k]
+  sum(h^2) = sum over d of n(d) hyp[d][k]^2
+  sum(h.t) = sum over d of hyp[d][k] T(d)
+
+The pass over the traces only adds each trace to 16 class sums, O(N.S) per
+byte; the Pearson matrix then costs 256 x 256 x S per byte, whatever N, and
+can be recomputed after every batch of traces. The class sums are centered
+on the mean trace before the products (sum(h.t) - sum(h).sum(t)/n in one
+step).
+
+*/
+
+#include <string.h>
+#include <math.h>
+#include <thread>
+#include "cpa.h"
+
+#define BLOCK 64
+
+void cpa_classes_init(cpa_classes_t* cls, const trace_set_t* set)
+{
+  size_t n = set->traces < BLOCK ? set->traces : BLOCK;
+  std::vector<double> x(n*set->samples);
+  size_t t, s;
+
+  cls->n = 0;
+  cls->samples = set->samples;
+  cls->shift.assign(set->samples, 0.0);
+  memset(cls->count, 0, sizeof(cls->count));
+  cls->st.assign(set->samples, 0.0);
+  cls->st2.assign(set->samples, 0.0);
+  cls->sum.assign((size_t)CPA_BYTES*256*set->samples, 0.0);
+
+  // Shift : the mean of the first block, as cpa_sums_init
+  trace_rows(set, 0, n, x.data());
+  for(t=0;t<n;t++)
+  {
+    for(s=0;s<set->samples;s++)
+    {
+      cls->shift[s] += x[t*set->samples + s] / n;
+    }
+  }
+}
+
+// Bytes b0..b1-1 over traces first..first+n-1; the first slice also takes
+// sum(t) and sum(t^2)
+static void AddSlice(cpa_classes_t* cls, const trace_set_t* set, const cpa_model_t* model,
+                     size_t first, size_t n, int b0, int b1)
+{
+  const size_t S = cls->samples;
+  std::vector<double> x(BLOCK*S);
+  size_t done, m, t, s;
+  int b;
+
+  for(done=0;done<n;done+=m)
+  {
+    m = n - done < BLOCK ? n - done : BLOCK;
+    trace_rows(set, first + done, m, x.data());
+    for(t=0;t<m;t++)
+    {
+      double* row = &x[t*S];
+      for(s=0;s<S;s++)
+      {
+        row[s] -= cls->shift[s];
+      }
+      if(b0 == 0)
+      {
+        for(s=0;s<S;s++)
+        {
+          cls->st[s] += row[s];
+          cls->st2[s] += row[s]*row[s];
+        }
+      }
+      for(b=b0;b<b1;b++)
+      {
+        const uint8_t d = cpa_data(set, model, first + done + t, b);
+        double* acc = &cls->sum[((size_t)b*256 + d)*S];
+        cls->count[b][d]++;
+        for(s=0;s<S;s++)
+        {
+          acc[s] += row[s];
+        }
+      }
+    }
+  }
+}
+
+void cpa_classes_add(cpa_classes_t* cls, const trace_set_t* set, const cpa_model_t* model,
+                     size_t first, size_t n, unsigned threads)
+{
+  std::vector<std::thread> pool;
+  int per;
+  unsigned i;
+
+  if(threads == 0)
+  {
+    threads = 1;
+  }
+  per = (int)((CPA_BYTES + threads - 1) / threads);
+  for(i=1;i<threads;i++)
+  {
+    int b0 = (int)i*per, b1 = b0 + per < CPA_BYTES ? b0 + per : CPA_BYTES;
+    if(b0 < b1)
+    {
+      pool.push_back(std::thread(AddSlice, cls, set, model, first, n, b0, b1));
+    }
+  }
+  AddSlice(cls, set, model, first, n, 0, per < CPA_BYTES ? per : CPA_BYTES);
+  for(i=0;i<pool.size();i++)
+  {
+    pool[i].join();
+  }
+  cls->n += n;
+}
+
+void cpa_classes_add_row(cpa_classes_t* cls, const trace_set_t* set, const cpa_model_t* model,
+                         size_t t, const double* row)
+{
+  const size_t S = cls->samples;
+  size_t s;
+  int b;
+
+  for(s=0;s<S;s++)
+  {
+    const double v = row[s] - cls->shift[s];
+    cls->st[s] += v;
+    cls->st2[s] += v*v;
+  }
+  for(b=0;b<CPA_BYTES;b++)
+  {
+    const uint8_t d = cpa_data(set, model, t, b);
+    double* acc = &cls->sum[((size_t)b*256 + d)*S];
+    cls->count[b][d]++;
+    for(s=0;s<S;s++)
+    {
+      acc[s] += row[s] - cls->shift[s];
+    }
+  }
+  cls->n++;
+}
+
+// Guesses of bytes b0..b1-1
+static void PearsonSlice(const cpa_classes_t* cls, const cpa_model_t* model, const double* vt,
+                         cpa_result_t* res, int b0, int b1)
+{
+  const size_t S = cls->samples;
+  const double n = (double)cls->n;
+  std::vector<double> centered(256*S);
+  size_t s;
+  int b, d, k;
+
+  for(b=b0;b<b1;b++)
+  {
+    // T(d) - n(d).mean(t)
+    for(d=0;d<256;d++)
+    {
+      const double* sum = &cls->sum[((size_t)b*256 + d)*S];
+      for(s=0;s<S;s++)
+      {
+        centered[d*S + s] = sum[s] - cls->count[b][d]*cls->st[s]/n;
+      }
+    }
+    for(k=0;k<CPA_GUESSES;k++)
+    {
+      double* r = &res->r[((size_t)b*CPA_GUESSES + k)*S];
+      double sh = 0, sh2 = 0, vh;
+
+      for(d=0;d<256;d++)
+      {
+        const double v = model->hyp[d][k];
+        sh += cls->count[b][d]*v;
+        sh2 += cls->count[b][d]*v*v;
+        if(v == 0 || cls->count[b][d] == 0)
+        {
+          continue;
+        }
+        for(s=0;s<S;s++)
+        {
+          r[s] += v*centered[d*S + s];
+        }
+      }
+      vh = sh2 - sh*sh/n;
+      for(s=0;s<S;s++)
+      {
+        // Constant hypothesis or sample : no correlation
+        r[s] = vh > 0 && vt[s] > 0 ? r[s] / sqrt(vh*vt[s]) : 0.0;
+      }
+    }
+  }
+}
+
+void cpa_classes_pearson(const cpa_classes_t* cls, const cpa_model_t* model, unsigned threads,
+                         cpa_result_t* res)
+{
+  const size_t S = cls->samples;
+  const double n = (double)cls->n;
+  std::vector<double> vt(S);
+  std::vector<std::thread> pool;
+  size_t s;
+  int per;
+  unsigned i;
+
+  res->traces = cls->n;
+  res->samples = S;
+  res->r.assign((size_t)CPA_HYPS*S, 0.0);
+  for(s=0;s<S;s++)
+  {
+    vt[s] = cls->st2[s] - cls->st[s]*cls->st[s]/n;
+  }
+
+  if(threads == 0)
+  {
+    threads = 1;
+  }
+  per = (int)((CPA_BYTES + threads - 1) / threads);
+  for(i=1;i<threads;i++)
+  {
+    int b0 = (int)i*per, b1 = b0 + per < CPA_BYTES ? b0 + per : CPA_BYTES;
+    if(b0 < b1)
+    {
+      pool.push_back(std::thread(PearsonSlice, cls, model, vt.data(), res, b0, b1));
+    }
+  }
+  PearsonSlice(cls, model, vt.data(), res, 0, per < CPA_BYTES ? per : CPA_BYTES);
+  for(i=0;i<pool.size();i++)
+  {
+    pool[i].join();
+  }
+  cpa_peaks(res);
+}
@@ -0,0 +1,132 @@
+/* Guessing entropy curves : PGE against the number of traces, in one pass. */
+
+/*
+
+The class sums of cpa_classes_t are a complete snapshot of the attack : the
+Pearson matrix after any number of traces comes from them at a cost that
+does not depend on that number. So the traces are added step by step and
+ranked after each step, instead of rerunning the attack per trace count.
+
+Bootstrap runs draw their traces at random (with replacement) from the
+first n; their mean PGE and success rate (PGE 0) estimate what another
+campaign of the same size would give. Each run is seeded by its number, so
+the curves do not depend on the threads.
+
+*/
+
+#include <thread>
+#include "cpa.h"
+
+// SplitMix64
+static uint64_t Next(uint64_t* state)
+{
+  uint64_t z = (*state += 0x9e3779b97f4a7c15ull);
+  z = (z ^ (z >> 30))*0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27))*0x94d049bb133111ebull;
+  return z ^ (z >> 31);
+}
+
+// One run : run < 0 takes the traces in order, with threads; otherwise a
+// bootstrap sample, single-threaded. pge : checkpoints x CPA_BYTES
+static void Run(const trace_set_t* set, const cpa_model_t* model, const uint8_t* key, size_t n,
+                size_t step, int run, unsigned threads, int* pge)
+{
+  cpa_classes_t cls;
+  cpa_result_t res;
+  std::vector<double> row(set->samples);
+  uint8_t best[CPA_BYTES];
+  uint64_t state = (uint64_t)run + 1;
+  size_t done, m, i, t;
+
+  cpa_classes_init(&cls, set);
+  for(done=0;done<n;done+=m)
+  {
+    m = n - done < step ? n - done : step;
+    if(run < 0)
+    {
+      cpa_classes_add(&cls, set, model, done, m, threads);
+    }
+    else
+    {
+      for(i=0;i<m;i++)
+      {
+        t = Next(&state) % n;
+        trace_rows(set, t, 1, row.data());
+        cpa_classes_add_row(&cls, set, model, t, row.data());
+      }
+    }
+    cpa_classes_pearson(&cls, model, threads, &res);
+    cpa_rank(&res, key, best, pge);
+    pge += CPA_BYTES;
+  }
+}
+
+// Runs r0, r0 + every, ...
+static void Runs(const trace_set_t* set, const cpa_model_t* model, const uint8_t* key, size_t n,
+                 size_t step, int r0, int every, int runs, int* pge)
+{
+  const size_t points = (n + step - 1) / step;
+  int r;
+
+  for(r=r0;r<runs;r+=every)
+  {
+    Run(set, model, key, n, step, r, 1, pge + (size_t)r*points*CPA_BYTES);
+  }
+}
+
+void cpa_curve(const trace_set_t* set, const cpa_model_t* model, const uint8_t* key, size_t n,
+               size_t step, int runs, unsigned threads, cpa_curve_t* curve)
+{
+  size_t points, c;
+  std::vector<int> pge;
+  std::vector<std::thread> pool;
+  unsigned i;
+  int r, b;
+
+  if(threads == 0)
+  {
+    threads = 1;
+  }
+  if(step == 0 || step > n)
+  {
+    step = n;
+  }
+  runs = runs > 1 ? runs : 1;
+  points = (n + step - 1) / step;
+  pge.assign((size_t)runs*points*CPA_BYTES, 0);
+
+  if(runs == 1)
+  {
+    Run(set, model, key, n, step, -1, threads, pge.data());
+  }
+  else
+  {
+    for(i=1;i<threads && (int)i<runs;i++)
+    {
+      pool.push_back(std::thread(Runs, set, model, key, n, step, (int)i, (int)threads, runs, pge.data()));
+    }
+    Runs(set, model, key, n, step, 0, (int)threads, runs, pge.data());
+    for(i=0;i<pool.size();i++)
+    {
+      pool[i].join();
+    }
+  }
+
+  curve->runs = runs;
+  curve->traces.resize(points);
+  curve->pge.assign(points*CPA_BYTES, 0.0);
+  curve->success.assign(points*CPA_BYTES, 0.0);
+  for(c=0;c<points;c++)
+  {
+    curve->traces[c] = (c + 1)*step < n ? (c + 1)*step : n;
+    for(r=0;r<runs;r++)
+    {
+      for(b=0;b<CPA_BYTES;b++)
+      {
+        const int v = pge[((size_t)r*points + c)*CPA_BYTES + b];
+        curve->pge[c*CPA_BYTES + b] += (double)v / runs;
+        curve->success[c*CPA_BYTES + b] += v == 0 ? 1.0 / runs : 0.0;
+      }
+    }
+  }
+}
@@ -0,0 +1,262 @@
+/* GEMM CPA : the correlation numerators of all hypotheses as one matrix product. */
+
+/*
+
+The formula of grasshopper_cpa.py, two passes :
+
+  mean trace m(s), mean hypothesis mh(h), over the traces
+  num(h, s)   = sum over t of (h(t) - mh(h)) (t(s) - m(s))
+  den1(h)     = sum of (h(t) - mh(h))^2
+  den2(s)     = sum of (t(s) - m(s))^2
+  r(h, s)     = num / sqrt(den1 den2)
+
+num is Hc^T x Tc, Hc the N x 4096 centered hypotheses and Tc the N x samples
+centered traces : a dense product, blocked as in GotoBLAS.
+
+  - KC traces at a time : Tc packed in NR-wide column panels (the B panel,
+    KC x samples, in L3), one L1 micro-panel per kernel call.
+  - MC hypotheses at a time per thread : Hc packed in MR-wide row panels
+    (the A block, MC x KC, in L2).
+  - The micro-kernel keeps an MR x NR block of num in registers over the
+    KC traces : MR broadcasts and MR x NR/VLEN FMAs per trace.
+
+The hypotheses are built while packing (model table minus the mean); den1
+comes from the counts of each data byte value.
+
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <thread>
+#include "cpa.h"
+
+#ifdef __AVX512F__
+#define VLEN 8
+#else
+#define VLEN 4
+#endif
+
+typedef double vec_t __attribute__((vector_size(VLEN*sizeof(double))));
+
+#define MR 6               // hypotheses per micro-kernel
+#define NR (2*VLEN)        // samples per micro-kernel
+#define MC (16*MR)         // hypotheses per A block
+#define KC 256             // traces per B panel
+
+#define ROWS ((CPA_HYPS + MR - 1) / MR * MR)
+
+static double* AlignedDoubles(size_t n)
+{
+  void* p = NULL;
+  if(posix_memalign(&p, 64, (n ? n : 1)*sizeof(double)) != 0)
+  {
+    abort();
+  }
+  memset(p, 0, n*sizeof(double));
+  return (double*)p;
+}
+
+// c[MR][NR] (row stride ldc) += a[kc][MR]^T x b[kc][NR]
+static void Kernel(size_t kc, const double* a, const double* b, double* c, size_t ldc)
+{
+  vec_t acc[MR][2];
+  size_t t;
+  int i;
+
+  for(i=0;i<MR;i++)
+  {
+    acc[i][0] = *(const vec_t*)(c + i*ldc);
+    acc[i][1] = *(const vec_t*)(c + i*ldc + VLEN);
+  }
+  for(t=0;t<kc;t++)
+  {
+    const vec_t b0 = *(const vec_t*)(b + t*NR);
+    const vec_t b1 = *(const vec_t*)(b + t*NR + VLEN);
+#pragma GCC unroll 6
+    for(i=0;i<MR;i++)
+    {
+      const vec_t ai = a[t*MR + i] - (vec_t){};
+      acc[i][0] += ai*b0;
+      acc[i][1] += ai*b1;
+    }
+  }
+  for(i=0;i<MR;i++)
+  {
+    *(vec_t*)(c + i*ldc) = acc[i][0];
+    *(vec_t*)(c + i*ldc + VLEN) = acc[i][1];
+  }
+}
+
+typedef struct
+{
+  const trace_set_t* set;
+  const cpa_model_t* model;
+  const double*      mh;      // CPA_HYPS
+  size_t             cols;    // samples rounded up to NR
+  double*            num;     // ROWS x cols
+} gemm_t;
+
+// A block : hypotheses h0..h0+MC-1 of traces first..first+kc-1, in MR-wide
+// panels a[panel][t][MR]
+static void PackA(const gemm_t* g, size_t first, size_t kc, size_t h0, size_t rows, double* a)
+{
+  uint8_t data[KC][CPA_BYTES];
+  size_t p, t, h;
+  int i, b;
+
+  for(t=0;t<kc;t++)
+  {
+    for(b=0;b<CPA_BYTES;b++)
+    {
+      data[t][b] = cpa_data(g->set, g->model, first + t, b);
+    }
+  }
+  for(p=0;p<rows;p+=MR)
+  {
+    for(t=0;t<kc;t++)
+    {
+      for(i=0;i<MR;i++)
+      {
+        h = h0 + p + i;
+        *a++ = h < CPA_HYPS ? g->model->hyp[data[t][h / CPA_GUESSES]][h % CPA_GUESSES] - g->mh[h] : 0.0;
+      }
+    }
+  }
+}
+
+// Hypotheses [h0, h1) against the packed B panel
+static void Block(const gemm_t* g, size_t first, size_t kc, const double* bp, size_t h0, size_t h1)
+{
+  double* a = AlignedDoubles((size_t)MC*KC);
+  size_t ic, rows, jp, ip;
+
+  for(ic=h0;ic<h1;ic+=MC)
+  {
+    rows = h1 - ic < MC ? h1 - ic : MC;
+    PackA(g, first, kc, ic, rows, a);
+    for(jp=0;jp<g->cols;jp+=NR)
+    {
+      for(ip=0;ip<rows;ip+=MR)
+      {
+        Kernel(kc, a + ip*kc, bp + jp*kc, g->num + (ic + ip)*g->cols + jp, g->cols);
+      }
+    }
+  }
+  free(a);
+}
+
+void cpa_gemm(const trace_set_t* set, const cpa_model_t* model, size_t first, size_t n,
+              unsigned threads, cpa_result_t* res)
+{
+  const size_t S = set->samples;
+  const size_t cols = (S + NR - 1) / NR * NR;
+  double* mean = AlignedDoubles(S);
+  double* den2 = AlignedDoubles(S);
+  double* x = AlignedDoubles((size_t)KC*S);
+  double* bp = AlignedDoubles((size_t)KC*cols);
+  double mh[CPA_HYPS], den1[CPA_HYPS];
+  double count[CPA_BYTES][256];
+  size_t done, kc, t, s, h, per;
+  std::vector<std::thread> pool;
+  gemm_t g;
+  unsigned i;
+  int b, d;
+
+  if(threads == 0)
+  {
+    threads = 1;
+  }
+
+  // Pass 1 : mean trace, data byte counts, mean hypotheses and den1
+  memset(count, 0, sizeof(count));
+  for(done=0;done<n;done+=kc)
+  {
+    kc = n - done < KC ? n - done : KC;
+    trace_rows(set, first + done, kc, x);
+    for(t=0;t<kc;t++)
+    {
+      for(s=0;s<S;s++)
+      {
+        mean[s] += x[t*S + s];
+      }
+      for(b=0;b<CPA_BYTES;b++)
+      {
+        count[b][cpa_data(set, model, first + done + t, b)]++;
+      }
+    }
+  }
+  for(s=0;s<S;s++)
+  {
+    mean[s] /= n;
+  }
+  for(h=0;h<CPA_HYPS;h++)
+  {
+    b = (int)(h / CPA_GUESSES);
+    mh[h] = 0;
+    for(d=0;d<256;d++)
+    {
+      mh[h] += count[b][d]*model->hyp[d][h % CPA_GUESSES];
+    }
+    mh[h] /= n;
+    den1[h] = 0;
+    for(d=0;d<256;d++)
+    {
+      double v = model->hyp[d][h % CPA_GUESSES] - mh[h];
+      den1[h] += count[b][d]*v*v;
+    }
+  }
+
+  // Pass 2 : num += Hc^T x Tc, one B panel of KC traces at a time
+  g.set = set;
+  g.model = model;
+  g.mh = mh;
+  g.cols = cols;
+  g.num = AlignedDoubles((size_t)ROWS*cols);
+  per = (CPA_HYPS / threads + MC - 1) / MC * MC;
+  for(done=0;done<n;done+=kc)
+  {
+    kc = n - done < KC ? n - done : KC;
+    trace_rows(set, first + done, kc, x);
+    memset(bp, 0, (size_t)kc*cols*sizeof(double));
+    for(t=0;t<kc;t++)
+    {
+      for(s=0;s<S;s++)
+      {
+        double v = x[t*S + s] - mean[s];
+        den2[s] += v*v;
+        bp[(s / NR)*kc*NR + t*NR + s % NR] = v;
+      }
+    }
+
+    for(i=1;i<threads && i*per<CPA_HYPS;i++)
+    {
+      size_t h1 = (i + 1)*per < CPA_HYPS ? (i + 1)*per : CPA_HYPS;
+      pool.push_back(std::thread(Block, &g, first + done, kc, bp, i*per, h1));
+    }
+    Block(&g, first + done, kc, bp, 0, per < CPA_HYPS ? per : CPA_HYPS);
+    for(i=0;i<pool.size();i++)
+    {
+      pool[i].join();
+    }
+    pool.clear();
+  }
+
+  res->traces = n;
+  res->samples = S;
+  res->r.assign((size_t)CPA_HYPS*S, 0.0);
+  for(h=0;h<CPA_HYPS;h++)
+  {
+    for(s=0;s<S;s++)
+    {
+      res->r[h*S + s] = den1[h] > 0 && den2[s] > 0 ? g.num[h*cols + s] / sqrt(den1[h]*den2[s]) : 0.0;
+    }
+  }
+  cpa_peaks(res);
+
+  free(g.num);
+  free(mean);
+  free(den2);
+  free(x);
+  free(bp);
+}
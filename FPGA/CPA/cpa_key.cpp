@@ -0,0 +1,353 @@
+/* Full-key rank and enumeration from the 16 x 256 CPA scores. */
+
+/*
+
+Score of guess k of byte b : with n traces, atanh(max |r|) sqrt(n - 3) is
+about normal (Fisher), so (n - 3) atanh(max |r|)^2 / 2 is a log-likelihood
+and the score of a 128-bit key is the sum of its 16 byte scores.
+
+Rank (Glowacz et al., histogram convolution) : the scores of every byte in
+a histogram of common bin width w, the 16 histograms convolved (the counts
+of the keys per total bin), the keys counted above the bin of the key. Each
+byte is off by less than a bin, so the rank is bounded by the counts beyond
+16 bins on either side of it.
+
+Enumeration : best first over the 16 guess lists sorted by score, a node
+being the position reached in every list. The children of a node increment
+one position at or after the last one it incremented, so every key has a
+single parent and comes out once, in exact score order. The candidates go
+by batches to the threads, which check each against a known plaintext /
+ciphertext : the attacked round key and the other key of its pair of the
+key schedule (K9 with K10, K2 with K1) give all the round keys, by the
+Feistel network of the key schedule run backwards (or forwards).
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <queue>
+#include <thread>
+#include "cpa.h"
+
+extern "C" {
+#include "kuznyechik.h"
+#include "kuznyechik_internal.h"
+}
+
+#define BATCH 65536
+
+void cpa_scores(const cpa_result_t* res, double score[CPA_BYTES][CPA_GUESSES])
+{
+  const double n = res->traces > 3 ? (double)(res->traces - 3) : 1.0;
+  int b, k;
+
+  for(b=0;b<CPA_BYTES;b++)
+  {
+    for(k=0;k<CPA_GUESSES;k++)
+    {
+      const double r = res->maxabs[b][k] < 0.999999 ? res->maxabs[b][k] : 0.999999;
+      score[b][k] = n*atanh(r)*atanh(r)/2;
+    }
+  }
+}
+
+/*****************************************************************************/
+/* Rank                                                                      */
+/*****************************************************************************/
+
+void cpa_key_rank(const double score[CPA_BYTES][CPA_GUESSES], const uint8_t* key, int bins,
+                  double* lo, double* hi)
+{
+  std::vector<double> h(1, 1.0), next;
+  double low[CPA_BYTES], width = 0, above = 0, maybe = 0;
+  size_t keyBin = 0, i;
+  int b, k, j;
+
+  for(b=0;b<CPA_BYTES;b++)
+  {
+    double top = score[b][0];
+    low[b] = score[b][0];
+    for(k=1;k<CPA_GUESSES;k++)
+    {
+      low[b] = std::min(low[b], score[b][k]);
+      top = std::max(top, score[b][k]);
+    }
+    width = std::max(width, (top - low[b]) / (bins - 1));
+  }
+  width = width > 0 ? width : 1.0;
+
+  for(b=0;b<CPA_BYTES;b++)
+  {
+    std::vector<double> byte(bins, 0.0);
+    for(k=0;k<CPA_GUESSES;k++)
+    {
+      byte[(size_t)((score[b][k] - low[b]) / width)]++;
+    }
+    keyBin += (size_t)((score[b][key[b]] - low[b]) / width);
+
+    next.assign(h.size() + bins - 1, 0.0);
+    for(j=0;j<bins;j++)
+    {
+      if(byte[j] == 0)
+      {
+        continue;
+      }
+      for(i=0;i<h.size();i++)
+      {
+        next[i + j] += byte[j]*h[i];
+      }
+    }
+    h.swap(next);
+  }
+
+  // Surely above : 16 bins or more above the key; maybe : more than 16 below
+  for(i=0;i<h.size();i++)
+  {
+    if(i >= keyBin + CPA_BYTES)
+    {
+      above += h[i];
+    }
+    if(i + CPA_BYTES > keyBin)
+    {
+      maybe += h[i];
+    }
+  }
+  *lo = log2(1 + above);
+  *hi = log2(maybe);
+}
+
+/*****************************************************************************/
+/* Candidate check                                                           */
+/*****************************************************************************/
+
+static lsblock_t C[32];
+
+// Round constants C_i = L(i), i = 1..32
+static void InitConstants(void)
+{
+  int i;
+
+  for(i=0;i<32;i++)
+  {
+    memset(C[i].b, 0, KUZ_BLOCK_SIZE);
+    C[i].b[KUZ_BLOCK_SIZE - 1] = (uint8_t)(i + 1);
+    kuz_lstep(C[i].b);
+  }
+}
+
+// L(S(x))
+static void LS(const lsblock_t* x, lsblock_t* y)
+{
+  int j;
+  y->q[0] = LS_enc[0][x->b[0]].q[0];
+  y->q[1] = LS_enc[0][x->b[0]].q[1];
+  for(j=1;j<16;j++)
+  {
+    y->q[0] ^= LS_enc[j][x->b[j]].q[0];
+    y->q[1] ^= LS_enc[j][x->b[j]].q[1];
+  }
+}
+
+// All round keys from the pair of the candidate, then one encryption
+static int Check(const cpa_check_t* chk, const uint8_t* cand, uint8_t* master)
+{
+  kuz_ctx_t ctx;
+  lsblock_t a, b, t, u;
+  uint8_t out[KUZ_BLOCK_SIZE];
+  int i;
+
+  if(chk->last)
+  {
+    // (K9, K10) back to (K1, K2) : (a, b) = (b', a' ^ LS(b' ^ C))
+    memcpy(a.b, chk->half, KUZ_BLOCK_SIZE);
+    memcpy(b.b, cand, KUZ_BLOCK_SIZE);
+    memcpy(ctx.rk[8], a.b, KUZ_BLOCK_SIZE);
+    memcpy(ctx.rk[9], b.b, KUZ_BLOCK_SIZE);
+    for(i=31;i>=0;i--)
+    {
+      t.q[0] = b.q[0] ^ C[i].q[0];
+      t.q[1] = b.q[1] ^ C[i].q[1];
+      LS(&t, &u);
+      t = b;
+      b.q[0] = a.q[0] ^ u.q[0];
+      b.q[1] = a.q[1] ^ u.q[1];
+      a = t;
+      if((i & 7) == 0)
+      {
+        memcpy(ctx.rk[i >> 2], a.b, KUZ_BLOCK_SIZE);
+        memcpy(ctx.rk[(i >> 2) + 1], b.b, KUZ_BLOCK_SIZE);
+      }
+    }
+  }
+  else
+  {
+    // (K1, K2) forward, as KeyExpansionFast()
+    memcpy(a.b, cand, KUZ_BLOCK_SIZE);
+    memcpy(b.b, chk->half, KUZ_BLOCK_SIZE);
+    memcpy(ctx.rk[0], a.b, KUZ_BLOCK_SIZE);
+    memcpy(ctx.rk[1], b.b, KUZ_BLOCK_SIZE);
+    for(i=0;i<32;i++)
+    {
+      t.q[0] = a.q[0] ^ C[i].q[0];
+      t.q[1] = a.q[1] ^ C[i].q[1];
+      LS(&t, &u);
+      t = a;
+      a.q[0] = b.q[0] ^ u.q[0];
+      a.q[1] = b.q[1] ^ u.q[1];
+      b = t;
+      if((i & 7) == 7)
+      {
+        memcpy(ctx.rk[(i >> 2) + 1], a.b, KUZ_BLOCK_SIZE);
+        memcpy(ctx.rk[(i >> 2) + 2], b.b, KUZ_BLOCK_SIZE);
+      }
+    }
+  }
+
+  kuz_encrypt(&ctx, chk->pt, out);
+  if(memcmp(out, chk->ct, KUZ_BLOCK_SIZE) != 0)
+  {
+    return 0;
+  }
+  memcpy(master, ctx.rk[0], KUZ_BLOCK_SIZE);
+  memcpy(master + KUZ_BLOCK_SIZE, ctx.rk[1], KUZ_BLOCK_SIZE);
+  return 1;
+}
+
+// Candidates [c0, c1) of the batch; the first passing one in *hit
+static void CheckSlice(const cpa_check_t* chk, const uint8_t* cand, size_t c0, size_t c1,
+                       size_t* hit, uint8_t* master)
+{
+  size_t c;
+  *hit = (size_t)-1;
+  for(c=c0;c<c1;c++)
+  {
+    if(Check(chk, cand + c*CPA_BYTES, master))
+    {
+      *hit = c;
+      return;
+    }
+  }
+}
+
+/*****************************************************************************/
+/* Enumeration                                                               */
+/*****************************************************************************/
+
+typedef struct
+{
+  double  score;
+  uint8_t pos[CPA_BYTES];    // position in the sorted list of every byte
+  uint8_t last;              // last position incremented
+} node_t;
+
+struct NodeLess
+{
+  bool operator()(const node_t& x, const node_t& y) const { return x.score < y.score; }
+};
+
+size_t cpa_enumerate(const double score[CPA_BYTES][CPA_GUESSES], size_t max, const cpa_check_t* chk,
+                     const uint8_t* key, unsigned threads, uint8_t* found, uint8_t* master)
+{
+  uint8_t order[CPA_BYTES][CPA_GUESSES];
+  std::priority_queue<node_t, std::vector<node_t>, NodeLess> heap;
+  std::vector<uint8_t> cand;
+  std::vector<size_t> hit(threads ? threads : 1);
+  std::vector<std::vector<uint8_t> > masters(hit.size(), std::vector<uint8_t>(KUZ_KEY_SIZE));
+  std::vector<std::thread> pool;
+  size_t done = 0, n, per, c;
+  node_t node, child;
+  unsigned i;
+  int b, k;
+
+  threads = (unsigned)hit.size();
+  if(chk != NULL)
+  {
+    InitConstants();
+  }
+
+  // Guesses of every byte by decreasing score (ties : smaller guess first)
+  for(b=0;b<CPA_BYTES;b++)
+  {
+    for(k=0;k<CPA_GUESSES;k++)
+    {
+      order[b][k] = (uint8_t)k;
+    }
+    std::stable_sort(order[b], order[b] + CPA_GUESSES,
+                     [&](uint8_t x, uint8_t y) { return score[b][x] > score[b][y]; });
+  }
+
+  memset(&node, 0, sizeof(node));
+  for(b=0;b<CPA_BYTES;b++)
+  {
+    node.score += score[b][order[b][0]];
+  }
+  heap.push(node);
+
+  while(done < max && !heap.empty())
+  {
+    // Next batch, best first
+    cand.clear();
+    while(cand.size() < BATCH*CPA_BYTES && done + cand.size() / CPA_BYTES < max && !heap.empty())
+    {
+      node = heap.top();
+      heap.pop();
+      for(b=0;b<CPA_BYTES;b++)
+      {
+        cand.push_back(order[b][node.pos[b]]);
+      }
+      for(b=node.last;b<CPA_BYTES;b++)
+      {
+        if(node.pos[b] + 1 < CPA_GUESSES)
+        {
+          child = node;
+          child.pos[b]++;
+          child.last = (uint8_t)b;
+          child.score += score[b][order[b][child.pos[b]]] - score[b][order[b][node.pos[b]]];
+          heap.push(child);
+        }
+      }
+    }
+    n = cand.size() / CPA_BYTES;
+
+    if(chk == NULL)
+    {
+      // Known key : its position in the enumeration
+      for(c=0;c<n && key != NULL;c++)
+      {
+        if(memcmp(&cand[c*CPA_BYTES], key, CPA_BYTES) == 0)
+        {
+          memcpy(found, key, CPA_BYTES);
+          return done + c + 1;
+        }
+      }
+      done += n;
+      continue;
+    }
+
+    per = (n + threads - 1) / threads;
+    for(i=1;i<threads && i*per<n;i++)
+    {
+      pool.push_back(std::thread(CheckSlice, chk, cand.data(), i*per, std::min(n, (i + 1)*per),
+                                 &hit[i], masters[i].data()));
+    }
+    CheckSlice(chk, cand.data(), 0, std::min(n, per), &hit[0], masters[0].data());
+    for(i=0;i<pool.size();i++)
+    {
+      pool[i].join();
+    }
+    pool.clear();
+    for(i=0;i<threads && i*per<n;i++)
+    {
+      if(hit[i] != (size_t)-1)
+      {
+        memcpy(found, &cand[hit[i]*CPA_BYTES], CPA_BYTES);
+        memcpy(master, masters[i].data(), KUZ_KEY_SIZE);
+        return done + hit[i] + 1;
+      }
+    }
+    done += n;
+  }
+  return 0;
+}
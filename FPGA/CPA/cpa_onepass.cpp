@@ -0,0 +1,171 @@
+/* One-pass CPA : running sums of all 16 x 256 hypotheses, each trace read once. */
+
+/*
+
+For n traces t and the hypothesis h of every (byte, guess) :
+
+  r = (sum(h.t) - sum(h).sum(t)/n) / sqrt((sum(h^2) - sum(h)^2/n) (sum(t^2) - sum(t)^2/n))
+
+per sample. The traces go by chunks of CHUNK : the calling thread converts
+a chunk to doubles once (with sum(t) and sum(t^2)), then every thread takes
+its slice of the 4096 hypotheses over it, BLOCK traces at a time, so its
+rows of sum(h.t) stay in its cache while the block goes through. Nothing is
+recomputed per guess : grasshopper_cpa.py walks all traces 4096 times.
+
+*/
+
+#include <string.h>
+#include <math.h>
+#include <thread>
+#include "cpa.h"
+
+#define BLOCK 64
+#define CHUNK 1024         // traces converted between two starts of the threads
+
+void cpa_sums_init(cpa_sums_t* sums, const trace_set_t* set)
+{
+  size_t n = set->traces < BLOCK ? set->traces : BLOCK;
+  std::vector<double> x(n*set->samples);
+  size_t t, s;
+
+  sums->n = 0;
+  sums->samples = set->samples;
+  sums->shift.assign(set->samples, 0.0);
+  memset(sums->sh, 0, sizeof(sums->sh));
+  memset(sums->sh2, 0, sizeof(sums->sh2));
+  sums->st.assign(set->samples, 0.0);
+  sums->st2.assign(set->samples, 0.0);
+  sums->sht.assign((size_t)CPA_HYPS*set->samples, 0.0);
+
+  // Shift : the mean of the first block
+  trace_rows(set, 0, n, x.data());
+  for(t=0;t<n;t++)
+  {
+    for(s=0;s<set->samples;s++)
+    {
+      sums->shift[s] += x[t*set->samples + s] / n;
+    }
+  }
+}
+
+// Traces first..first+m-1 into x (minus the shift) and data, once for all
+// the slices; sum(t) and sum(t^2) on the way
+static void Convert(cpa_sums_t* sums, const trace_set_t* set, const cpa_model_t* model,
+                    size_t first, size_t m, double* x, uint8_t* data)
+{
+  const size_t S = sums->samples;
+  size_t t, s;
+  int b;
+
+  trace_rows(set, first, m, x);
+  for(t=0;t<m;t++)
+  {
+    double* row = &x[t*S];
+    for(s=0;s<S;s++)
+    {
+      row[s] -= sums->shift[s];
+      sums->st[s] += row[s];
+      sums->st2[s] += row[s]*row[s];
+    }
+    for(b=0;b<CPA_BYTES;b++)
+    {
+      data[t*CPA_BYTES + b] = cpa_data(set, model, first + t, b);
+    }
+  }
+}
+
+// Hypotheses h0..h1-1 over the m converted traces, BLOCK traces at a time
+static void Slice(cpa_sums_t* sums, const cpa_model_t* model, const double* x, const uint8_t* data,
+                  size_t m, size_t h0, size_t h1)
+{
+  const size_t S = sums->samples;
+  size_t done, k, t, s, h;
+
+  for(done=0;done<m;done+=k)
+  {
+    k = m - done < BLOCK ? m - done : BLOCK;
+    for(h=h0;h<h1;h++)
+    {
+      const size_t byte = h / CPA_GUESSES, guess = h % CPA_GUESSES;
+      double* acc = &sums->sht[h*S];
+      for(t=done;t<done+k;t++)
+      {
+        const double v = model->hyp[data[t*CPA_BYTES + byte]][guess];
+        const double* row = &x[t*S];
+        sums->sh[h] += v;
+        sums->sh2[h] += v*v;
+        if(v == 0)
+        {
+          continue;
+        }
+        for(s=0;s<S;s++)
+        {
+          acc[s] += v*row[s];
+        }
+      }
+    }
+  }
+}
+
+void cpa_onepass(cpa_sums_t* sums, const trace_set_t* set, const cpa_model_t* model,
+                 size_t first, size_t n, unsigned threads)
+{
+  const size_t S = sums->samples;
+  std::vector<double> x(CHUNK*S);
+  std::vector<uint8_t> data(CHUNK*CPA_BYTES);
+  std::vector<std::thread> pool;
+  size_t done, m, per;
+  unsigned i;
+
+  if(threads == 0)
+  {
+    threads = 1;
+  }
+  per = (CPA_HYPS + threads - 1) / threads;
+  for(done=0;done<n;done+=m)
+  {
+    m = n - done < CHUNK ? n - done : CHUNK;
+    Convert(sums, set, model, first + done, m, x.data(), data.data());
+
+    for(i=1;i<threads && i*per<CPA_HYPS;i++)
+    {
+      size_t h1 = (i + 1)*per < CPA_HYPS ? (i + 1)*per : CPA_HYPS;
+      pool.push_back(std::thread(Slice, sums, model, x.data(), data.data(), m, i*per, h1));
+    }
+    Slice(sums, model, x.data(), data.data(), m, 0, per < CPA_HYPS ? per : CPA_HYPS);
+    for(i=0;i<pool.size();i++)
+    {
+      pool[i].join();
+    }
+    pool.clear();
+  }
+  sums->n += n;
+}
+
+void cpa_pearson(const cpa_sums_t* sums, cpa_result_t* res)
+{
+  const size_t S = sums->samples;
+  const double n = (double)sums->n;
+  std::vector<double> vt(S);
+  size_t h, s;
+
+  res->traces = sums->n;
+  res->samples = S;
+  res->r.assign((size_t)CPA_HYPS*S, 0.0);
+  for(s=0;s<S;s++)
+  {
+    vt[s] = sums->st2[s] - sums->st[s]*sums->st[s]/n;
+  }
+  for(h=0;h<CPA_HYPS;h++)
+  {
+    const double vh = sums->sh2[h] - sums->sh[h]*sums->sh[h]/n;
+    const double* sht = &sums->sht[h*S];
+    double* r = &res->r[h*S];
+    for(s=0;s<S;s++)
+    {
+      // Constant hypothesis or sample : no correlation
+      r[s] = vh > 0 && vt[s] > 0 ? (sht[s] - sums->sh[h]*sums->st[s]/n) / sqrt(vh*vt[s]) : 0.0;
+    }
+  }
+  cpa_peaks(res);
+}
@@ -0,0 +1,361 @@
+/* kuz_cpa : CPA attack on Kuznyechik power traces, the native grasshopper_cpa.py. */
+
+/*
+
+  kuz_cpa [options] [traces.npy ... | STORE]
+
+Without trace files, the campaign of grasshopper_cpa.py : traces_1.npy to
+traces_4.npy and clair_chiffre.txt in ../DPA_traces. A trace store (see
+kuz_store) holds its own plaintexts / ciphertexts.
+
+  --pairs FILE      plaintext / ciphertext lines (clair_chiffre.txt) or
+                    pairs file (kuz_store pairs)
+  --model M         ct (HW(ct[b] ^ k), default), sbox, sbox-hd : see cpa.h
+  --engine E        classes (conditional averaging, default), gemm (two
+                    passes) or onepass : see cpa.h
+  --key HEX         known 16-byte key for the PGE (default : knownkey of
+                    grasshopper_cpa.py), --key none to skip it
+  --traces N        only the first N traces
+  --threads N       default : all CPUs
+  --curve K         PGE curves instead : after every K traces (see cpa.h)
+  --bootstrap R     with --curve, mean PGE and success rate over R runs on
+                    traces drawn with replacement
+  --rank            bounds of the rank of the full 16-byte key (needs --key)
+  --enumerate N     up to N full keys by decreasing score : the position of
+                    --key, or the first key passing --check
+  --check PT:CT:HALF  known plaintext / ciphertext and the other round key
+                    of the pair of the key schedule : K9 with the ct model
+                    (K10 attacked), K2 with sbox models (K1); prints the
+                    32-byte master key
+
+stdout has the two lists of grasshopper_cpa.py (best key guess, partial
+guessing entropy), stderr a table per byte : best guess, its max |r| and
+sample, PGE. With --curve, stdout has one line per step : number of traces,
+PGE of the 16 bytes, then their success rates with --bootstrap. --rank
+and --enumerate add their results to stderr.
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+#include "cpa.h"
+
+static const uint8_t knownKey[CPA_BYTES] = {
+  0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77 };
+
+static const char* defaultTraces[] = {
+  "../DPA_traces/traces_1.npy", "../DPA_traces/traces_2.npy",
+  "../DPA_traces/traces_3.npy", "../DPA_traces/traces_4.npy" };
+
+#define RANK_BINS 2048
+
+static double Seconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+static int ParseKey(const char* s, uint8_t* key)
+{
+  unsigned v;
+  int i;
+
+  if(strlen(s) != 2*CPA_BYTES)
+  {
+    return -1;
+  }
+  for(i=0;i<CPA_BYTES;i++)
+  {
+    if(sscanf(s + 2*i, "%2x", &v) != 1)
+    {
+      return -1;
+    }
+    key[i] = (uint8_t)v;
+  }
+  return 0;
+}
+
+// PT:CT:HALF
+static int ParseCheck(const char* s, cpa_check_t* chk)
+{
+  char part[2*CPA_BYTES + 1];
+  uint8_t* out[3] = { chk->pt, chk->ct, chk->half };
+  int i;
+
+  if(strlen(s) != 3*2*CPA_BYTES + 2 || s[2*CPA_BYTES] != ':' || s[4*CPA_BYTES + 1] != ':')
+  {
+    return -1;
+  }
+  for(i=0;i<3;i++)
+  {
+    memcpy(part, s + i*(2*CPA_BYTES + 1), 2*CPA_BYTES);
+    part[2*CPA_BYTES] = 0;
+    if(ParseKey(part, out[i]) != 0)
+    {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+static void Usage(const char* name)
+{
+  fprintf(stderr, "usage: %s [--pairs clair_chiffre.txt] [--model ct|sbox|sbox-hd] [--key HEX32|none]\n"
+                  "       [--engine classes|gemm|onepass] [--traces N] [--threads N]\n"
+                  "       [--curve K [--bootstrap R]] [--rank] [--enumerate N [--check PT:CT:HALF]]\n"
+                  "       [traces.npy ... | STORE]\n", name);
+}
+
+static void Hex(const char* label, const uint8_t* v, int n)
+{
+  int i;
+  fprintf(stderr, "%s", label);
+  for(i=0;i<n;i++)
+  {
+    fprintf(stderr, "%02x", v[i]);
+  }
+  fprintf(stderr, "\n");
+}
+
+// Full-key rank and enumeration
+static void ReportKey(const cpa_result_t* res, const uint8_t* key, int rank, size_t max,
+                      const cpa_check_t* chk, unsigned threads)
+{
+  double score[CPA_BYTES][CPA_GUESSES];
+  uint8_t found[CPA_BYTES], master[2*CPA_BYTES];
+  double lo, hi, t0;
+  size_t pos;
+
+  cpa_scores(res, score);
+  if(rank && key != NULL)
+  {
+    cpa_key_rank(score, key, RANK_BINS, &lo, &hi);
+    fprintf(stderr, "key rank : 2^%.1f .. 2^%.1f\n", lo, hi);
+  }
+  if(max == 0 || (chk == NULL && key == NULL))
+  {
+    return;
+  }
+
+  t0 = Seconds();
+  pos = cpa_enumerate(score, max, chk, key, threads, found, master);
+  fprintf(stderr, "enumeration : %s at %zu of %zu (%.2f s)\n", pos ? "found" : "not found",
+          pos, max, Seconds() - t0);
+  if(pos != 0 && chk != NULL)
+  {
+    Hex("round key  : ", found, CPA_BYTES);
+    Hex("master key : ", master, 2*CPA_BYTES);
+  }
+}
+
+static void ReportCurve(const cpa_curve_t* curve)
+{
+  size_t c;
+  int b;
+
+  printf("# traces, PGE of bytes 0..15%s\n", curve->runs > 1 ? " (mean), success rate of bytes 0..15" : "");
+  for(c=0;c<curve->traces.size();c++)
+  {
+    printf("%zu", curve->traces[c]);
+    for(b=0;b<CPA_BYTES;b++)
+    {
+      printf(curve->runs > 1 ? " %.2f" : " %.0f", curve->pge[c*CPA_BYTES + b]);
+    }
+    for(b=0;b<CPA_BYTES && curve->runs > 1;b++)
+    {
+      printf(" %.2f", curve->success[c*CPA_BYTES + b]);
+    }
+    printf("\n");
+  }
+}
+
+static void Report(const cpa_result_t* res, const uint8_t* key)
+{
+  uint8_t best[CPA_BYTES];
+  int pge[CPA_BYTES];
+  int b;
+
+  cpa_rank(res, key, best, pge);
+
+  fprintf(stderr, "byte  best  max|r|    sample  pge\n");
+  for(b=0;b<CPA_BYTES;b++)
+  {
+    fprintf(stderr, "%4d  %02x    %.6f  %6zu", b, best[b], res->maxabs[b][best[b]], res->peak[b][best[b]]);
+    if(key != NULL)
+    {
+      fprintf(stderr, "  %3d", pge[b]);
+    }
+    fprintf(stderr, "\n");
+  }
+
+  printf("Best Key Guess : \n");
+  for(b=0;b<CPA_BYTES;b++)
+  {
+    printf("%02x\n", best[b]);
+  }
+  if(key != NULL)
+  {
+    printf("Partial Guessing Entropy : \n");
+    for(b=0;b<CPA_BYTES;b++)
+    {
+      printf("%d\n", pge[b]);
+    }
+  }
+}
+
+int main(int argc, char** argv)
+{
+  const char* pairs = NULL;
+  const char* modelName = "ct";
+  const char* engine = "classes";
+  std::vector<const char*> files;
+  uint8_t key[CPA_BYTES];
+  const uint8_t* useKey = key;
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  unsigned threads = cpus > 0 ? (unsigned)cpus : 1;
+  size_t traces = 0, step = 0, enumerate = 0;
+  int runs = 1, rank = 0;
+  cpa_check_t check;
+  const cpa_check_t* useCheck = NULL;
+  trace_set_t set;
+  cpa_model_t model;
+  cpa_result_t res;
+  double t0;
+  int a;
+
+  memcpy(key, knownKey, CPA_BYTES);
+  trace_init(&set);
+
+  for(a=1;a<argc;a++)
+  {
+    const char* v = a + 1 < argc ? argv[a + 1] : NULL;
+
+    if(argv[a][0] != '-')
+    {
+      files.push_back(argv[a]);
+      continue;
+    }
+    if(strcmp(argv[a], "--rank") == 0)
+    {
+      rank = 1;
+      continue;
+    }
+    if(v == NULL)
+    {
+      Usage(argv[0]);
+      return 2;
+    }
+    if(strcmp(argv[a], "--pairs") == 0)         pairs = v;
+    else if(strcmp(argv[a], "--model") == 0)    modelName = v;
+    else if(strcmp(argv[a], "--engine") == 0)   engine = v;
+    else if(strcmp(argv[a], "--traces") == 0)   traces = strtoull(v, NULL, 0);
+    else if(strcmp(argv[a], "--threads") == 0)  threads = (unsigned)atoi(v);
+    else if(strcmp(argv[a], "--curve") == 0)    step = strtoull(v, NULL, 0);
+    else if(strcmp(argv[a], "--bootstrap") == 0) runs = atoi(v);
+    else if(strcmp(argv[a], "--enumerate") == 0) enumerate = strtoull(v, NULL, 0);
+    else if(strcmp(argv[a], "--check") == 0 && ParseCheck(v, &check) == 0) useCheck = &check;
+    else if(strcmp(argv[a], "--key") == 0 && strcmp(v, "none") == 0) useKey = NULL;
+    else if(strcmp(argv[a], "--key") == 0 && ParseKey(v, key) == 0) {}
+    else
+    {
+      Usage(argv[0]);
+      return 2;
+    }
+    a++;
+  }
+  if(files.empty())
+  {
+    files.assign(defaultTraces, defaultTraces + 4);
+  }
+
+  if(cpa_model_init(&model, modelName) != 0)
+  {
+    return 2;
+  }
+  check.last = model.useCt;
+  if(strcmp(engine, "classes") != 0 && strcmp(engine, "gemm") != 0 && strcmp(engine, "onepass") != 0)
+  {
+    fprintf(stderr, "unknown engine %s (classes, gemm, onepass)\n", engine);
+    return 2;
+  }
+  for(size_t i=0;i<files.size();i++)
+  {
+    if(trace_open(&set, files[i]) != 0)
+    {
+      return 2;
+    }
+  }
+  // The pairs of a store, unless --pairs
+  if(pairs == NULL && set.meta == NULL)
+  {
+    pairs = "../DPA_traces/clair_chiffre.txt";
+  }
+  if(pairs != NULL && trace_load_pairs(&set, pairs) != 0)
+  {
+    return 2;
+  }
+  if(set.metaCount < set.traces)
+  {
+    fprintf(stderr, "%s: %zu pairs for %zu traces\n", pairs ? pairs : files[0], set.metaCount, set.traces);
+    return 2;
+  }
+  if(traces != 0 && traces < set.traces)
+  {
+    set.traces = traces;
+  }
+  if(set.traces == 0)
+  {
+    fprintf(stderr, "no traces\n");
+    return 2;
+  }
+
+  if(step != 0)
+  {
+    cpa_curve_t curve;
+    if(useKey == NULL)
+    {
+      fprintf(stderr, "--curve needs the key\n");
+      return 2;
+    }
+    t0 = Seconds();
+    cpa_curve(&set, &model, useKey, set.traces, step, runs, threads, &curve);
+    fprintf(stderr, "%zu traces x %zu samples, model %s, curve every %zu traces, %d runs, %u threads : %.2f s\n",
+            set.traces, set.samples, model.name, step, curve.runs, threads, Seconds() - t0);
+    ReportCurve(&curve);
+    trace_close(&set);
+    return 0;
+  }
+
+  t0 = Seconds();
+  if(strcmp(engine, "classes") == 0)
+  {
+    cpa_classes_t cls;
+    cpa_classes_init(&cls, &set);
+    cpa_classes_add(&cls, &set, &model, 0, set.traces, threads);
+    cpa_classes_pearson(&cls, &model, threads, &res);
+  }
+  else if(strcmp(engine, "gemm") == 0)
+  {
+    cpa_gemm(&set, &model, 0, set.traces, threads, &res);
+  }
+  else
+  {
+    cpa_sums_t sums;
+    cpa_sums_init(&sums, &set);
+    cpa_onepass(&sums, &set, &model, 0, set.traces, threads);
+    cpa_pearson(&sums, &res);
+  }
+  fprintf(stderr, "%zu traces x %zu samples, model %s, engine %s, %u threads : %.2f s\n",
+          set.traces, set.samples, model.name, engine, threads, Seconds() - t0);
+
+  Report(&res, useKey);
+  ReportKey(&res, useKey, rank, enumerate, useCheck, threads);
+  trace_close(&set);
+  return 0;
+}
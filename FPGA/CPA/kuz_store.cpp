@@ -0,0 +1,322 @@
+/* kuz_store : trace stores from .npy traces and clair_chiffre.txt pairs, pairs files. */
+
+/*
+
+  kuz_store import STORE [options] traces.npy ...
+  kuz_store append STORE [options] traces.npy ...
+  kuz_store info STORE
+  kuz_store pairs clair_chiffre.txt PAIRS
+
+import creates STORE from the .npy files (in order) and their pairs; append
+adds more of them to an existing STORE, which can be read (kuz_cpa) at the
+same time. pairs converts clair_chiffre.txt into a pairs file (see cpa.h),
+which kuz_cpa and kuz_store read wherever they take clair_chiffre.txt.
+
+  --pairs FILE      plaintext / ciphertext lines or pairs file (default
+                    clair_chiffre.txt)
+  --type T          int8, int16, float32 or float64 (import only; default :
+                    the type of the first file, float32 for float64)
+  --key HEX         16-byte key of every trace (default : none, zeros)
+
+Floating-point samples going to an integer store are scaled on their range
+(import) or with the gain / offset of the store (append, clamped).
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+#include "cpa.h"
+
+#define BATCH 1024
+
+static const char* typeName[] = { "int8", "int16", "float32", "float64" };
+
+static void Usage(const char* name)
+{
+  fprintf(stderr, "usage: %s import|append STORE [--pairs clair_chiffre.txt] [--type int8|int16|float32|float64]\n"
+                  "       [--key HEX32] traces.npy ...\n"
+                  "       %s info STORE\n"
+                  "       %s pairs clair_chiffre.txt PAIRS\n", name, name, name);
+}
+
+static int ParseKey(const char* s, uint8_t* key)
+{
+  unsigned v;
+  int i;
+
+  if(strlen(s) != 2*CPA_BYTES)
+  {
+    return -1;
+  }
+  for(i=0;i<CPA_BYTES;i++)
+  {
+    if(sscanf(s + 2*i, "%2x", &v) != 1)
+    {
+      return -1;
+    }
+    key[i] = (uint8_t)v;
+  }
+  return 0;
+}
+
+static int ParseType(const char* s, sample_type_t* type)
+{
+  int i;
+  for(i=0;i<=SAMPLE_FLOAT64;i++)
+  {
+    if(strcmp(s, typeName[i]) == 0)
+    {
+      *type = (sample_type_t)i;
+      return 0;
+    }
+  }
+  return -1;
+}
+
+static int IsInteger(sample_type_t type)
+{
+  return type == SAMPLE_INT8 || type == SAMPLE_INT16;
+}
+
+// Gain / offset putting [lo, hi] on the range of an integer type
+static void Scale(sample_type_t type, double lo, double hi, double* gain, double* offset)
+{
+  const double top = type == SAMPLE_INT8 ? 127.0 : 32767.0;
+  *offset = (lo + hi) / 2;
+  *gain = hi > lo ? (hi - lo) / (2*top) : 1.0;
+}
+
+// n x samples values into raw samples of the store
+static void Quantize(const double* x, size_t count, sample_type_t type, double gain, double offset, uint8_t* raw)
+{
+  const double top = type == SAMPLE_INT8 ? 127.0 : 32767.0;
+  size_t i;
+
+  for(i=0;i<count;i++)
+  {
+    double v;
+    switch(type)
+    {
+      case SAMPLE_FLOAT32: ((float*)raw)[i] = (float)x[i]; break;
+      case SAMPLE_FLOAT64: ((double*)raw)[i] = x[i];       break;
+      default:
+        v = nearbyint((x[i] - offset) / gain);
+        v = v > top ? top : v < -top - 1 ? -top - 1 : v;
+        if(type == SAMPLE_INT8)
+        {
+          ((int8_t*)raw)[i] = (int8_t)v;
+        }
+        else
+        {
+          ((int16_t*)raw)[i] = (int16_t)v;
+        }
+        break;
+    }
+  }
+}
+
+static int Info(const char* name)
+{
+  trace_set_t set;
+  const trace_file_t* f;
+  const uint8_t* rec;
+  int i;
+
+  trace_init(&set);
+  if(trace_open_store(&set, name) != 0)
+  {
+    return 2;
+  }
+  f = &set.files[0];
+  printf("%zu traces x %zu samples, %s, %zu bytes per record, value = raw * %g + %g\n",
+         set.traces, set.samples, typeName[f->type], f->stride, f->gain, f->offset);
+  if(set.traces > 0)
+  {
+    rec = set.meta;
+    printf("trace 0 : pt ");
+    for(i=0;i<CPA_BYTES;i++) printf("%02x", rec[i]);
+    printf(" ct ");
+    for(i=0;i<CPA_BYTES;i++) printf("%02x", rec[CPA_BYTES + i]);
+    printf(" key ");
+    for(i=0;i<CPA_BYTES;i++) printf("%02x", rec[2*CPA_BYTES + i]);
+    printf("\n");
+  }
+  trace_close(&set);
+  return 0;
+}
+
+static int Pairs(const char* text, const char* name)
+{
+  trace_set_t set;
+  int ret;
+
+  trace_init(&set);
+  if(trace_load_pairs(&set, text) != 0)
+  {
+    return 2;
+  }
+  ret = pairs_write(name, set.meta, set.metaCount);
+  if(ret == 0)
+  {
+    fprintf(stderr, "%s: %zu pairs\n", name, set.metaCount);
+  }
+  trace_close(&set);
+  return ret == 0 ? 0 : 2;
+}
+
+int main(int argc, char** argv)
+{
+  const char* pairs = "clair_chiffre.txt";
+  const char* typeArg = NULL;
+  std::vector<const char*> files;
+  uint8_t key[CPA_BYTES];
+  int useKey = 0, append;
+  sample_type_t type = SAMPLE_FLOAT32;
+  trace_set_t set;
+  trace_store_t st;
+  double gain = 1.0, offset = 0.0;
+  size_t i, done, n;
+  int a;
+
+  if(argc == 3 && strcmp(argv[1], "info") == 0)
+  {
+    return Info(argv[2]);
+  }
+  if(argc == 4 && strcmp(argv[1], "pairs") == 0)
+  {
+    return Pairs(argv[2], argv[3]);
+  }
+  if(argc < 4 || (strcmp(argv[1], "import") != 0 && strcmp(argv[1], "append") != 0))
+  {
+    Usage(argv[0]);
+    return 2;
+  }
+  append = strcmp(argv[1], "append") == 0;
+
+  for(a=3;a<argc;a++)
+  {
+    const char* v = a + 1 < argc ? argv[a + 1] : NULL;
+
+    if(argv[a][0] != '-')
+    {
+      files.push_back(argv[a]);
+      continue;
+    }
+    if(v == NULL)
+    {
+      Usage(argv[0]);
+      return 2;
+    }
+    if(strcmp(argv[a], "--pairs") == 0)                                 pairs = v;
+    else if(strcmp(argv[a], "--type") == 0 && ParseType(v, &type) == 0) typeArg = v;
+    else if(strcmp(argv[a], "--key") == 0 && ParseKey(v, key) == 0)     useKey = 1;
+    else
+    {
+      Usage(argv[0]);
+      return 2;
+    }
+    a++;
+  }
+  if(files.empty())
+  {
+    Usage(argv[0]);
+    return 2;
+  }
+
+  trace_init(&set);
+  for(i=0;i<files.size();i++)
+  {
+    if(trace_open_npy(&set, files[i]) != 0)
+    {
+      return 2;
+    }
+  }
+  if(trace_load_pairs(&set, pairs) != 0)
+  {
+    return 2;
+  }
+  if(set.metaCount < set.traces)
+  {
+    fprintf(stderr, "%s: %zu pairs for %zu traces\n", pairs, set.metaCount, set.traces);
+    return 2;
+  }
+
+  std::vector<double> x(BATCH*set.samples);
+  std::vector<uint8_t> pt(BATCH*CPA_BYTES), ct(BATCH*CPA_BYTES), keys(BATCH*CPA_BYTES);
+
+  if(append)
+  {
+    if(store_open_append(&st, argv[2]) != 0)
+    {
+      return 2;
+    }
+    if(st.h.samples != set.samples)
+    {
+      fprintf(stderr, "%s: %zu samples per trace, %zu in the store\n", files[0], set.samples, (size_t)st.h.samples);
+      return 2;
+    }
+    type = (sample_type_t)st.h.type;
+    gain = st.h.gain;
+    offset = st.h.offset;
+  }
+  else
+  {
+    if(typeArg == NULL)
+    {
+      type = set.files[0].type == SAMPLE_FLOAT64 ? SAMPLE_FLOAT32 : set.files[0].type;
+    }
+    // Integer samples keep their values; floats are scaled on their range
+    for(i=0;i<set.files.size() && IsInteger(type);i++)
+    {
+      if(!IsInteger(set.files[i].type))
+      {
+        double lo = HUGE_VAL, hi = -HUGE_VAL;
+        for(done=0;done<set.traces;done+=n)
+        {
+          n = set.traces - done < BATCH ? set.traces - done : BATCH;
+          trace_rows(&set, done, n, x.data());
+          for(size_t s=0;s<n*set.samples;s++)
+          {
+            lo = x[s] < lo ? x[s] : lo;
+            hi = x[s] > hi ? x[s] : hi;
+          }
+        }
+        Scale(type, lo, hi, &gain, &offset);
+        break;
+      }
+    }
+    if(store_create(&st, argv[2], type, set.samples, gain, offset) != 0)
+    {
+      return 2;
+    }
+  }
+
+  std::vector<uint8_t> raw(BATCH*set.samples*trace_sample_size[type]);
+  for(i=0;i<BATCH && useKey;i++)
+  {
+    memcpy(&keys[i*CPA_BYTES], key, CPA_BYTES);
+  }
+  for(done=0;done<set.traces;done+=n)
+  {
+    n = set.traces - done < BATCH ? set.traces - done : BATCH;
+    trace_rows(&set, done, n, x.data());
+    Quantize(x.data(), n*set.samples, type, gain, offset, raw.data());
+    for(i=0;i<n;i++)
+    {
+      memcpy(&pt[i*CPA_BYTES], set.meta + (done + i)*set.metaStride, CPA_BYTES);
+      memcpy(&ct[i*CPA_BYTES], set.meta + (done + i)*set.metaStride + CPA_BYTES, CPA_BYTES);
+    }
+    if(store_append(&st, n, pt.data(), ct.data(), useKey ? keys.data() : NULL, raw.data()) != 0)
+    {
+      return 2;
+    }
+  }
+  fprintf(stderr, "%s: %zu traces %s (%s), %zu in the store\n", argv[2], set.traces,
+          append ? "appended" : "imported", typeName[type], (size_t)st.h.traces);
+
+  trace_close(&set);
+  return store_close(&st) == 0 ? 0 : 2;
+}
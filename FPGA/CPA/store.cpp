@@ -0,0 +1,173 @@
+/* Trace stores and pairs files : writing (reading is in traces.cpp). */
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "cpa.h"
+
+// Whole buffer at offset, or -1
+static int WriteAt(int fd, const void* buf, size_t len, off_t offset)
+{
+  const uint8_t* p = (const uint8_t*)buf;
+  ssize_t w;
+
+  while(len > 0)
+  {
+    w = pwrite(fd, p, len, offset);
+    if(w <= 0)
+    {
+      return -1;
+    }
+    p += w;
+    len -= (size_t)w;
+    offset += w;
+  }
+  return 0;
+}
+
+int store_header_ok(const store_header_t* h)
+{
+  if(memcmp(h->magic, STORE_MAGIC, 8) != 0 || h->version != STORE_VERSION || h->type > SAMPLE_FLOAT64)
+  {
+    return 0;
+  }
+  // samples bounded first, so that the record size below cannot wrap
+  return h->samples <= (UINT64_MAX - STORE_META) / trace_sample_size[SAMPLE_FLOAT64] &&
+         h->recordSize >= STORE_META + h->samples*trace_sample_size[h->type];
+}
+
+int store_create(trace_store_t* st, const char* name, sample_type_t type, size_t samples,
+                 double gain, double offset)
+{
+  uint8_t header[STORE_HEADER];
+
+  st->fd = open(name, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if(st->fd < 0)
+  {
+    perror(name);
+    return -1;
+  }
+  memset(&st->h, 0, sizeof(st->h));
+  memcpy(st->h.magic, STORE_MAGIC, 8);
+  st->h.version = STORE_VERSION;
+  st->h.type = type;
+  st->h.samples = samples;
+  st->h.traces = 0;
+  st->h.recordSize = (STORE_META + samples*trace_sample_size[type] + 63) / 64 * 64;
+  st->h.gain = gain;
+  st->h.offset = offset;
+
+  memset(header, 0, sizeof(header));
+  memcpy(header, &st->h, sizeof(st->h));
+  if(WriteAt(st->fd, header, sizeof(header), 0) != 0)
+  {
+    perror(name);
+    close(st->fd);
+    return -1;
+  }
+  return 0;
+}
+
+int store_open_append(trace_store_t* st, const char* name)
+{
+  struct stat sb;
+
+  st->fd = open(name, O_RDWR);
+  if(st->fd < 0)
+  {
+    perror(name);
+    return -1;
+  }
+  if(pread(st->fd, &st->h, sizeof(st->h), 0) != (ssize_t)sizeof(st->h) || !store_header_ok(&st->h))
+  {
+    fprintf(stderr, "%s: not a trace store (version %u)\n", name, STORE_VERSION);
+    close(st->fd);
+    return -1;
+  }
+  // Complete records as counted, as trace_open_store checks them
+  if(fstat(st->fd, &sb) != 0 || (uint64_t)sb.st_size < STORE_HEADER + st->h.traces*st->h.recordSize)
+  {
+    fprintf(stderr, "%s: truncated\n", name);
+    close(st->fd);
+    return -1;
+  }
+  // Drops a record left partial by an interrupted append
+  if(ftruncate(st->fd, (off_t)(STORE_HEADER + st->h.traces*st->h.recordSize)) != 0)
+  {
+    perror(name);
+    close(st->fd);
+    return -1;
+  }
+  return 0;
+}
+
+int store_append(trace_store_t* st, size_t n, const uint8_t* pt, const uint8_t* ct,
+                 const uint8_t* key, const void* raw)
+{
+  const size_t R = st->h.recordSize;
+  const size_t bytes = st->h.samples*trace_sample_size[st->h.type];
+  size_t t;
+
+  st->buf.assign(n*R, 0);
+  for(t=0;t<n;t++)
+  {
+    uint8_t* rec = &st->buf[t*R];
+    memcpy(rec, pt + t*CPA_BYTES, CPA_BYTES);
+    memcpy(rec + CPA_BYTES, ct + t*CPA_BYTES, CPA_BYTES);
+    if(key != NULL)
+    {
+      memcpy(rec + 2*CPA_BYTES, key + t*CPA_BYTES, CPA_BYTES);
+    }
+    memcpy(rec + STORE_META, (const uint8_t*)raw + t*bytes, bytes);
+  }
+
+  // Records first, then the count that makes them visible
+  if(WriteAt(st->fd, st->buf.data(), n*R, (off_t)(STORE_HEADER + st->h.traces*R)) != 0)
+  {
+    perror("store_append");
+    return -1;
+  }
+  st->h.traces += n;
+  if(WriteAt(st->fd, &st->h.traces, sizeof(st->h.traces), offsetof(store_header_t, traces)) != 0)
+  {
+    perror("store_append");
+    return -1;
+  }
+  return 0;
+}
+
+int store_close(trace_store_t* st)
+{
+  int ret = fsync(st->fd);
+  if(close(st->fd) != 0 || ret != 0)
+  {
+    perror("store_close");
+    return -1;
+  }
+  return 0;
+}
+
+int pairs_write(const char* name, const uint8_t* rec, size_t n)
+{
+  pairs_header_t h;
+  int fd = open(name, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+  static_assert(sizeof(pairs_header_t) == PAIRS_RECORD, "one record of header");
+  if(fd < 0)
+  {
+    perror(name);
+    return -1;
+  }
+  memset(&h, 0, sizeof(h));
+  memcpy(h.magic, PAIRS_MAGIC, 8);
+  h.version = PAIRS_VERSION;
+  h.recordSize = PAIRS_RECORD;
+  if(WriteAt(fd, &h, sizeof(h), 0) != 0 || WriteAt(fd, rec, n*PAIRS_RECORD, sizeof(h)) != 0 || close(fd) != 0)
+  {
+    perror(name);
+    return -1;
+  }
+  return 0;
+}
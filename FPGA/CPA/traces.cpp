@@ -0,0 +1,442 @@
+/* Trace files of a campaign : .npy samples or trace stores, and pairs, mapped or from clair_chiffre.txt. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "cpa.h"
+
+const size_t trace_sample_size[] = { 1, 2, 4, 8 };
+
+/*****************************************************************************/
+/* .npy                                                                      */
+/*****************************************************************************/
+
+// Value of 'key' in the header dict of a .npy file, NULL if missing
+static const char* DictValue(const char* dict, const char* key)
+{
+  const char* p = strstr(dict, key);
+  if(p == NULL)
+  {
+    return NULL;
+  }
+  p += strlen(key);
+  while(*p == ' ' || *p == ':')
+  {
+    p++;
+  }
+  return p;
+}
+
+static int ParseNpyHeader(const char* name, const uint8_t* buf, size_t len, trace_file_t* f, size_t* dataStart)
+{
+  char dict[1024];
+  size_t hlen, pre;
+  const char* v;
+
+  if(len < 10 || memcmp(buf, "\x93NUMPY", 6) != 0)
+  {
+    fprintf(stderr, "%s: not a .npy file\n", name);
+    return -1;
+  }
+  if(buf[6] == 1)
+  {
+    hlen = buf[8] | (size_t)buf[9] << 8;
+    pre = 10;
+  }
+  else
+  {
+    hlen = buf[8] | (size_t)buf[9] << 8 | (size_t)buf[10] << 16 | (size_t)buf[11] << 24;
+    pre = 12;
+  }
+  if(hlen >= sizeof(dict) || pre + hlen > len)
+  {
+    fprintf(stderr, "%s: bad .npy header\n", name);
+    return -1;
+  }
+  memcpy(dict, buf + pre, hlen);
+  dict[hlen] = '\0';
+
+  v = DictValue(dict, "'descr'");
+  if(v == NULL)
+  {
+    fprintf(stderr, "%s: no descr\n", name);
+    return -1;
+  }
+  if(strncmp(v, "'<f8'", 5) == 0)
+  {
+    f->type = SAMPLE_FLOAT64;
+  }
+  else if(strncmp(v, "'<f4'", 5) == 0)
+  {
+    f->type = SAMPLE_FLOAT32;
+  }
+  else if(strncmp(v, "'<i2'", 5) == 0)
+  {
+    f->type = SAMPLE_INT16;
+  }
+  else if(strncmp(v, "'|i1'", 5) == 0 || strncmp(v, "'<i1'", 5) == 0)
+  {
+    f->type = SAMPLE_INT8;
+  }
+  else
+  {
+    fprintf(stderr, "%s: samples must be int8, int16, float32 or float64 (little-endian)\n", name);
+    return -1;
+  }
+
+  v = DictValue(dict, "'fortran_order'");
+  if(v == NULL || strncmp(v, "False", 5) != 0)
+  {
+    fprintf(stderr, "%s: Fortran order is not supported\n", name);
+    return -1;
+  }
+
+  v = DictValue(dict, "'shape'");
+  if(v == NULL || sscanf(v, "(%zu, %zu)", &f->rows, &f->samples) != 2)
+  {
+    fprintf(stderr, "%s: shape must be (traces, samples)\n", name);
+    return -1;
+  }
+  f->stride = f->samples*trace_sample_size[f->type];
+  f->gain = 1.0;
+  f->offset = 0.0;
+  *dataStart = pre + hlen;
+  if(*dataStart + f->rows*f->samples*trace_sample_size[f->type] > len)
+  {
+    fprintf(stderr, "%s: truncated\n", name);
+    return -1;
+  }
+  return 0;
+}
+
+void trace_init(trace_set_t* set)
+{
+  set->files.clear();
+  set->traces = 0;
+  set->samples = 0;
+  set->meta = NULL;
+  set->metaStride = 0;
+  set->metaCount = 0;
+  set->pairs.clear();
+  set->metaMap = NULL;
+  set->metaMapLen = 0;
+}
+
+// The whole file, read-only
+static int MapFile(const char* name, trace_file_t* f)
+{
+  struct stat st;
+  int fd = open(name, O_RDONLY);
+
+  if(fd < 0 || fstat(fd, &st) != 0)
+  {
+    perror(name);
+    if(fd >= 0)
+    {
+      close(fd);
+    }
+    return -1;
+  }
+  f->mapLen = (size_t)st.st_size;
+  f->map = f->mapLen ? mmap(NULL, f->mapLen, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+  close(fd);
+  if(f->map == MAP_FAILED)
+  {
+    fprintf(stderr, "%s: cannot map\n", name);
+    return -1;
+  }
+  return 0;
+}
+
+// A trace store opened in the set
+static int HasStore(const trace_set_t* set)
+{
+  return !set->files.empty() && memcmp(set->files[0].map, STORE_MAGIC, 8) == 0;
+}
+
+int trace_open(trace_set_t* set, const char* name)
+{
+  char magic[8];
+  FILE* f = fopen(name, "rb");
+
+  if(f == NULL)
+  {
+    perror(name);
+    return -1;
+  }
+  if(fread(magic, 1, sizeof(magic), f) != sizeof(magic))
+  {
+    memset(magic, 0, sizeof(magic));
+  }
+  fclose(f);
+  if(memcmp(magic, STORE_MAGIC, 8) == 0)
+  {
+    return trace_open_store(set, name);
+  }
+  return trace_open_npy(set, name);
+}
+
+int trace_open_npy(trace_set_t* set, const char* name)
+{
+  trace_file_t f;
+  size_t dataStart;
+
+  if(HasStore(set))
+  {
+    fprintf(stderr, "%s: a trace store is already open\n", name);
+    return -1;
+  }
+  if(MapFile(name, &f) != 0)
+  {
+    return -1;
+  }
+  if(ParseNpyHeader(name, (const uint8_t*)f.map, f.mapLen, &f, &dataStart) != 0)
+  {
+    munmap(f.map, f.mapLen);
+    return -1;
+  }
+  if(!set->files.empty() && f.samples != set->samples)
+  {
+    fprintf(stderr, "%s: %zu samples per trace, %zu in the first file\n", name, f.samples, set->samples);
+    munmap(f.map, f.mapLen);
+    return -1;
+  }
+  madvise(f.map, f.mapLen, MADV_SEQUENTIAL);
+  f.data = (const uint8_t*)f.map + dataStart;
+  set->files.push_back(f);
+  set->samples = f.samples;
+  set->traces += f.rows;
+  return 0;
+}
+
+int trace_open_store(trace_set_t* set, const char* name)
+{
+  trace_file_t f;
+  store_header_t h;
+
+  if(!set->files.empty())
+  {
+    fprintf(stderr, "%s: a trace store cannot be mixed with other trace files\n", name);
+    return -1;
+  }
+  if(MapFile(name, &f) != 0)
+  {
+    return -1;
+  }
+  if(f.mapLen < STORE_HEADER)
+  {
+    fprintf(stderr, "%s: not a trace store\n", name);
+    munmap(f.map, f.mapLen);
+    return -1;
+  }
+  memcpy(&h, f.map, sizeof(h));
+  if(!store_header_ok(&h))
+  {
+    fprintf(stderr, "%s: not a trace store (version %u)\n", name, STORE_VERSION);
+    munmap(f.map, f.mapLen);
+    return -1;
+  }
+  // Records appended after the header was read are not counted yet
+  if(STORE_HEADER + h.traces*h.recordSize > f.mapLen)
+  {
+    fprintf(stderr, "%s: truncated\n", name);
+    munmap(f.map, f.mapLen);
+    return -1;
+  }
+
+  f.type = (sample_type_t)h.type;
+  f.rows = h.traces;
+  f.samples = h.samples;
+  f.stride = h.recordSize;
+  f.gain = h.gain;
+  f.offset = h.offset;
+  f.data = (const uint8_t*)f.map + STORE_HEADER + STORE_META;
+  madvise(f.map, f.mapLen, MADV_SEQUENTIAL);
+  set->files.push_back(f);
+  set->samples = f.samples;
+  set->traces = f.rows;
+  set->meta = (const uint8_t*)f.map + STORE_HEADER;
+  set->metaStride = h.recordSize;
+  set->metaCount = h.traces;
+  return 0;
+}
+
+void trace_close(trace_set_t* set)
+{
+  size_t i;
+  for(i=0;i<set->files.size();i++)
+  {
+    munmap(set->files[i].map, set->files[i].mapLen);
+  }
+  if(set->metaMap != NULL)
+  {
+    munmap(set->metaMap, set->metaMapLen);
+  }
+  trace_init(set);
+}
+
+template<typename T>
+static void Convert(const uint8_t* src, size_t count, double gain, double offset, double* out)
+{
+  const T* p = (const T*)src;
+  size_t i;
+  for(i=0;i<count;i++)
+  {
+    out[i] = (double)p[i]*gain + offset;
+  }
+}
+
+static void ConvertRows(const trace_file_t* f, const uint8_t* src, size_t count, double* out)
+{
+  switch(f->type)
+  {
+    case SAMPLE_INT8:    Convert<int8_t>(src, count, f->gain, f->offset, out);  break;
+    case SAMPLE_INT16:   Convert<int16_t>(src, count, f->gain, f->offset, out); break;
+    case SAMPLE_FLOAT32: Convert<float>(src, count, f->gain, f->offset, out);   break;
+    case SAMPLE_FLOAT64: Convert<double>(src, count, f->gain, f->offset, out);  break;
+  }
+}
+
+void trace_rows(const trace_set_t* set, size_t first, size_t n, double* out)
+{
+  size_t i, rows, S = set->samples;
+
+  for(i=0;i<set->files.size() && n > 0;i++)
+  {
+    const trace_file_t* f = &set->files[i];
+    if(first >= f->rows)
+    {
+      first -= f->rows;
+      continue;
+    }
+    rows = f->rows - first < n ? f->rows - first : n;
+    const uint8_t* src = f->data + first*f->stride;
+    if(f->stride == S*trace_sample_size[f->type])
+    {
+      ConvertRows(f, src, rows*S, out);
+    }
+    else
+    {
+      // Trace store : samples after the metadata of each record
+      for(size_t r=0;r<rows;r++)
+      {
+        ConvertRows(f, src + r*f->stride, S, out + r*S);
+      }
+    }
+    out += rows*S;
+    n -= rows;
+    first = 0;
+  }
+}
+
+/*****************************************************************************/
+/* Pairs                                                                     */
+/*****************************************************************************/
+
+#define ONES 0x0101010101010101ull
+#define HIGH 0x8080808080808080ull
+
+// High bit of each byte of w (all < 0x80) set when lo <= byte <= hi
+static uint64_t InRange(uint64_t w, unsigned lo, unsigned hi)
+{
+  return (w + (0x80 - lo)*ONES) & ~(w + (0x7f - hi)*ONES) & HIGH;
+}
+
+// 16 bytes from 32 hex digits, 8 digits at a time in a 64-bit word
+static int HexBlock(const char* s, uint8_t* out)
+{
+  uint64_t w, n;
+  uint32_t v;
+  int i;
+
+  for(i=0;i<4;i++)
+  {
+    memcpy(&w, s + 8*i, 8);
+    if((w & HIGH) != 0 || (InRange(w, '0', '9') | InRange(w | 0x20*ONES, 'a', 'f')) != HIGH)
+    {
+      return -1;
+    }
+    // Digit values : low nibble, + 9 for letters (bit 6)
+    n = (w & 0x0f*ONES) + ((w >> 6) & ONES)*9;
+    // Pairs of digits into bytes, then the 4 bytes together
+    n = ((n << 4) | (n >> 8)) & 0x00ff00ff00ff00ffull;
+    n = (n | (n >> 8)) & 0x0000ffff0000ffffull;
+    v = (uint32_t)(n | (n >> 16));
+    memcpy(out + 4*i, &v, 4);
+  }
+  return 0;
+}
+
+// "<pt> <ct>" lines of Multiple_acquisitions.py, in hex, into 32-byte
+// records (pt then ct)
+static int ParsePairs(trace_set_t* set, const char* name, const char* text, size_t len)
+{
+  const char* end = text + len;
+  const char* eol;
+  size_t n = 0;
+
+  set->pairs.reserve(len / 66 * PAIRS_RECORD + PAIRS_RECORD);
+  while(text < end)
+  {
+    eol = (const char*)memchr(text, '\n', end - text);
+    eol = eol != NULL ? eol : end;
+    n++;
+    set->pairs.resize(n*PAIRS_RECORD);
+    if(eol - text < 65 || HexBlock(text, &set->pairs[(n - 1)*PAIRS_RECORD]) != 0 ||
+       HexBlock(text + 33, &set->pairs[(n - 1)*PAIRS_RECORD + CPA_BYTES]) != 0)
+    {
+      fprintf(stderr, "%s:%zu: expected \"<32 hex digits> <32 hex digits>\"\n", name, n);
+      return -1;
+    }
+    text = eol + 1;
+  }
+  set->meta = set->pairs.data();
+  set->metaStride = PAIRS_RECORD;
+  set->metaCount = n;
+  return 0;
+}
+
+int trace_load_pairs(trace_set_t* set, const char* name)
+{
+  trace_file_t f;
+  pairs_header_t h;
+  int ret;
+
+  if(MapFile(name, &f) != 0)
+  {
+    return -1;
+  }
+  if(set->metaMap != NULL)
+  {
+    munmap(set->metaMap, set->metaMapLen);
+    set->metaMap = NULL;
+  }
+  set->pairs.clear();
+
+  if(f.mapLen < sizeof(h) || memcmp(f.map, PAIRS_MAGIC, 8) != 0)
+  {
+    madvise(f.map, f.mapLen, MADV_SEQUENTIAL);
+    ret = ParsePairs(set, name, (const char*)f.map, f.mapLen);
+    munmap(f.map, f.mapLen);
+    return ret;
+  }
+
+  memcpy(&h, f.map, sizeof(h));
+  if(h.version != PAIRS_VERSION || h.recordSize != PAIRS_RECORD)
+  {
+    fprintf(stderr, "%s: not a pairs file (version %u)\n", name, PAIRS_VERSION);
+    munmap(f.map, f.mapLen);
+    return -1;
+  }
+  // A record being appended is not counted
+  set->metaMap = f.map;
+  set->metaMapLen = f.mapLen;
+  set->meta = (const uint8_t*)f.map + sizeof(h);
+  set->metaStride = PAIRS_RECORD;
+  set->metaCount = (f.mapLen - sizeof(h)) / PAIRS_RECORD;
+  return 0;
+}
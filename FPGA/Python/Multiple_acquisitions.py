@@ -5,6 +5,7 @@
 #imports
 import serial
 import random
+import struct
 import time
 
 #lists declarations
@@ -51,4 +52,13 @@ fichier = open("clair_chiffre.txt",'w')
 for k in range(len(liste_clairs)):
     fichier.write("{:032x} {:032x}\n".format(liste_clairs[k],liste_chiffres[k]))  #couples written in hexadecimal format
 
-fichier.close()
\ No newline at end of file
+fichier.close()
+
+#and in binary (pairs file, read by ../CPA/kuz_cpa) : a 32-byte header, then pt and ct, 16 bytes each, per trace
+fichier = open("clair_chiffre.bin",'wb')
+fichier.write(b"KUZPAIRS" + struct.pack("<II", 1, 32) + bytes(bytearray(16)))
+
+for k in range(len(liste_clairs)):
+    fichier.write(bytes(bytearray.fromhex("{:032x}{:032x}".format(liste_clairs[k],liste_chiffres[k]))))
+
+fichier.close()
@@ -7,6 +7,7 @@
 import numpy as np
 import grasshopper_data as grdata
 import os.path
+import struct
 
 cur_dir = os.path.dirname(__file__)
 
@@ -42,8 +43,32 @@ ct = [] #list of ciphertexts
 
 
 """ Storing the plaintexts and ciphertexts """
-file = open(os.path.join(cur_dir,'../DPA_traces/clair_chiffre.txt'),'r')
-lignes = file.readlines()
+pairs_file = os.path.join(cur_dir,'../DPA_traces/clair_chiffre.bin')
+text_file = os.path.join(cur_dir,'../DPA_traces/clair_chiffre.txt')
+pairs_ok = False
+if os.path.exists(pairs_file):
+  #binary pairs (Multiple_acquisitions.py, or ../CPA/kuz_store pairs) : 32-byte header ("KUZPAIRS", version 1, record size 32), then pt and ct (16 bytes each) per trace, mapped
+  #the header is checked as trace_load_pairs does (../CPA/traces.cpp)
+  with open(pairs_file,'rb') as f:
+    header = f.read(32)
+  if len(header) == 32:
+    magic, version, record = struct.unpack("<8sII", header[0:16])
+    pairs_ok = magic == b"KUZPAIRS" and version == 1 and record == 32
+  if not pairs_ok:
+    if not os.path.exists(text_file):
+      raise ValueError("{}: not a pairs file (version 1)".format(pairs_file))
+    print("{}: not a pairs file (version 1), reading {}".format(pairs_file, text_file))
+if pairs_ok:
+  #a record being appended is not counted
+  numpairs = (os.path.getsize(pairs_file) - 32) // 32
+  pairs = np.memmap(pairs_file, dtype=np.uint8, mode='r', offset=32, shape=(numpairs,32))
+  pt = pairs[:,0:16]
+  ct = pairs[:,16:32]
+  lignes = []
+else:
+  file = open(text_file,'r')
+  lignes = file.readlines()
+  file.close()
 for i in range(len(lignes)):
     inter_nb=lignes[i][33:66] #indices for the cipher text, which is a str format
     inter_nb_bis=lignes[i][0:32] #indices for the plaintext, wich is a str format
@@ -62,7 +87,6 @@ for i in range(len(lignes)):
     ct.append(ct_format)
     pt.append(pt_format)
       
-file.close()
 
 #print("pt[0] : {}".format(pt[0]))
 
@@ -38,6 +38,7 @@ void platform_init(void);
 #define CW308_STM32F4  18
 #define CW308_CC2538   19
 #define CW308_K24F     20
+#define HOST           21
 
 //HAL_TYPE Define Types
 #define HAL_avr     1
@@ -51,6 +52,7 @@ void platform_init(void);
 #define HAL_stm32f4 9
 #define HAL_cc2538  10
 #define HAL_k24f    11
+#define HAL_host    12
 
 #if HAL_TYPE == HAL_avr
     #include <avr/io.h>
@@ -84,6 +86,8 @@ void platform_init(void);
 	#include "cc2538/cc2538_hal.h"
 #elif HAL_TYPE == HAL_k24f
     #include "k24f/k24f_hal.h"
+#elif HAL_TYPE == HAL_host
+    #include "host/host_hal.h"
 #else
     #error "Unsupported HAL Type"
 #endif
@@ -0,0 +1,131 @@
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "host_hal.h"
+
+static FILE* uart_in;
+static FILE* uart_out;
+static int pty_slave = -1;
+
+static FILE* trigger_log;
+static uint64_t trigger_start;
+static uint64_t trigger_last;
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec*1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+void platform_init(void)
+{
+	uart_in = stdin;
+	uart_out = stdout;
+}
+
+//Master side of a raw pseudo-terminal, -1 on failure
+static int open_pty(void)
+{
+	struct termios tio;
+	int master = posix_openpt(O_RDWR | O_NOCTTY);
+
+	if(master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+		return -1;
+
+	//Keep the slave open : the master would read EIO between two clients
+	pty_slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+	if(pty_slave < 0 || tcgetattr(pty_slave, &tio) != 0)
+		return -1;
+	cfmakeraw(&tio);
+	tcsetattr(pty_slave, TCSANOW, &tio);
+
+	fprintf(stderr, "host uart: %s\n", ptsname(master));
+	return master;
+}
+
+void init_uart(void)
+{
+	int master;
+
+	if(getenv("HOST_PTY") == NULL)
+		return;
+
+	master = open_pty();
+	if(master < 0)
+	{
+		perror("host uart: pty");
+		exit(1);
+	}
+	uart_in = fdopen(master, "r");
+	uart_out = fdopen(dup(master), "w");
+}
+
+void putch(char c)
+{
+	putc(c, uart_out);
+	//SimpleSerial replies end with a newline
+	if(c == '\n')
+		fflush(uart_out);
+}
+
+char getch(void)
+{
+	int c = getc(uart_in);
+
+	if(c == EOF)
+	{
+		fflush(uart_out);
+		exit(0);
+	}
+	return (char)c;
+}
+
+void trigger_setup(void)
+{
+	const char* name = getenv("HOST_TRIGGER_LOG");
+
+	if(name == NULL)
+		return;
+	if(strcmp(name, "-") == 0)
+	{
+		trigger_log = stderr;
+		return;
+	}
+	trigger_log = fopen(name, "a");
+	if(trigger_log == NULL)
+	{
+		perror(name);
+		exit(1);
+	}
+	setvbuf(trigger_log, NULL, _IOLBF, 0);
+}
+
+void trigger_high(void)
+{
+	trigger_start = now_ns();
+}
+
+void trigger_low(void)
+{
+	uint64_t end = now_ns();
+
+	trigger_last = end - trigger_start;
+	if(trigger_log != NULL)
+	{
+		fprintf(trigger_log, "%llu %llu %llu\n", (unsigned long long)trigger_start,
+		        (unsigned long long)end, (unsigned long long)trigger_last);
+	}
+}
+
+uint64_t trigger_duration_ns(void)
+{
+	return trigger_last;
+}
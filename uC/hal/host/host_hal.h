@@ -0,0 +1,45 @@
+/*
+    This file is part of the ChipWhisperer Example Targets
+    Copyright (C) 2012-2015 NewAE Technology Inc.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef HOST_HAL_H_
+#define HOST_HAL_H_
+
+#include <stdint.h>
+
+//Native build (x86/Linux) : the firmware runs as a program on the host
+//
+//UART : stdin/stdout, or a pseudo-terminal if HOST_PTY is set in the
+//       environment (its name is printed on stderr, for a serial client)
+//Trigger : trigger_high/trigger_low read CLOCK_MONOTONIC; every high/low
+//       window is appended to the file named by HOST_TRIGGER_LOG ("-" for
+//       stderr) as "<high ns> <low ns> <duration ns>"
+//
+//The program exits when the UART input is closed.
+
+void init_uart(void);
+void putch(char c);
+char getch(void);
+
+void trigger_setup(void);
+void trigger_low(void);
+void trigger_high(void);
+
+//Last trigger window, in ns (0 before the first trigger_low)
+uint64_t trigger_duration_ns(void);
+
+#endif //HOST_HAL_H_
@@ -0,0 +1,335 @@
+/* Table generator for the Kuznyechik implementations (host program). */
+
+/*
+
+Every constant of the cipher but the S-box follows from the field
+polynomial and the 16 coefficients of the linear step :
+
+  GF(2^8) = GF(2)[x] / (x^8 + x^7 + x^6 + x + 1)
+  R : new byte 0 = 148.s0 + 32.s1 + 133.s2 + 16.s3 + 194.s4 + 192.s5 + 1.s6
+                 + 251.s7 + 1.s8 + 192.s9 + 194.s10 + 16.s11 + 133.s12
+                 + 32.s13 + 148.s14 + 1.s15, the other bytes shift up
+  L = R^16,  C[i] = L(i+1)
+
+The build runs this program to write the tables the C files include, so the
+reference, masked and table engines share one source :
+
+  gen_tables ref  > kuznyechik_tables.h     sbox, rsbox, mult_mod_poly, C
+  gen_tables ls   > kuznyechik_ls_tables.h  LS_enc, ILS_dec (LS-tables engines)
+
+Before writing anything the tables are checked against the C1 constant and
+the encryption test vector of the standard; the program fails otherwise.
+
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define POLY 0x1c3
+
+// pi, the S-box of the standard : the only constant that is not derived
+static const uint8_t pi[256] = {
+  252, 238, 221,  17, 207, 110,  49,  22, 251, 196, 250, 218,  35, 197,   4,  77,
+  233, 119, 240, 219, 147,  46, 153, 186,  23,  54, 241, 187,  20, 205,  95, 193,
+  249,  24, 101,  90, 226,  92, 239,  33, 129,  28,  60,  66, 139,   1, 142,  79,
+    5, 132,   2, 174, 227, 106, 143, 160,   6,  11, 237, 152, 127, 212, 211,  31,
+  235,  52,  44,  81, 234, 200,  72, 171, 242,  42, 104, 162, 253,  58, 206, 204,
+  181, 112,  14,  86,   8,  12, 118,  18, 191, 114,  19,  71, 156, 183,  93, 135,
+   21, 161, 150,  41,  16, 123, 154, 199, 243, 145, 120, 111, 157, 158, 178, 177,
+   50, 117,  25,  61, 255,  53, 138, 126, 109,  84, 198, 128, 195, 189,  13,  87,
+  223, 245,  36, 169,  62, 168,  67, 201, 215, 121, 214, 246, 124,  34, 185,   3,
+  224,  15, 236, 222, 122, 148, 176, 188, 220, 232,  40,  80,  78,  51,  10,  74,
+  167, 151,  96, 115,  30,   0,  98,  68,  26, 184,  56, 130, 100, 159,  38,  65,
+  173,  69,  70, 146,  39,  94,  85,  47, 140, 163, 165, 125, 105, 213, 149,  59,
+    7,  88, 179,  64, 134, 172,  29, 247,  48,  55, 107, 228, 136, 217, 231, 137,
+  225,  27, 131,  73,  76,  63, 248, 254, 141,  83, 170, 144, 202, 216, 133,  97,
+   32, 113, 103, 164,  45,  43,   9,  91, 203, 155,  37, 208, 190, 229, 108,  82,
+   89, 166, 116, 210, 230, 244, 180, 192, 209, 102, 175, 194,  57,  75,  99, 182 };
+
+static const uint8_t lcoef[16] = {
+  148, 32, 133, 16, 194, 192, 1, 251, 1, 192, 194, 16, 133, 32, 148, 1 };
+
+// The distinct coefficients, in the row order of mult_mod_poly[8][256]
+static const uint8_t rows[8] = { 1, 16, 32, 133, 148, 192, 194, 251 };
+
+static uint8_t rpi[256];
+static uint8_t C[32][16];
+
+static uint8_t gmul(uint8_t a, uint8_t b)
+{
+  uint16_t x = a;
+  uint8_t r = 0;
+
+  while(b)
+  {
+    if(b & 1)
+    {
+      r ^= (uint8_t)x;
+    }
+    x <<= 1;
+    if(x & 0x100)
+    {
+      x ^= POLY;
+    }
+    b >>= 1;
+  }
+  return r;
+}
+
+static void Rstep(uint8_t* s)
+{
+  uint8_t t = 0;
+  int i;
+
+  for(i=0;i<16;i++)
+  {
+    t ^= gmul(lcoef[i], s[i]);
+  }
+  memmove(s + 1, s, 15);
+  s[0] = t;
+}
+
+static void InvRstep(uint8_t* s)
+{
+  uint8_t t = s[0];
+  int i;
+
+  memmove(s, s + 1, 15);
+  s[15] = t;
+  t = 0;
+  for(i=0;i<16;i++)
+  {
+    t ^= gmul(lcoef[i], s[i]);
+  }
+  s[15] = t;
+}
+
+static void Lstep(uint8_t* s)
+{
+  int i;
+  for(i=0;i<16;i++)
+  {
+    Rstep(s);
+  }
+}
+
+static void InvLstep(uint8_t* s)
+{
+  int i;
+  for(i=0;i<16;i++)
+  {
+    InvRstep(s);
+  }
+}
+
+static void Build(void)
+{
+  int i;
+
+  for(i=0;i<256;i++)
+  {
+    rpi[pi[i]] = (uint8_t)i;
+  }
+  for(i=0;i<32;i++)
+  {
+    memset(C[i], 0, 16);
+    C[i][15] = (uint8_t)(i + 1);
+    Lstep(C[i]);
+  }
+}
+
+/*****************************************************************************/
+/* Self check                                                                */
+/*****************************************************************************/
+
+static void LSX(uint8_t* s, const uint8_t* k)
+{
+  int i;
+  for(i=0;i<16;i++)
+  {
+    s[i] = pi[s[i] ^ k[i]];
+  }
+  Lstep(s);
+}
+
+static int Check(void)
+{
+  static const uint8_t c1[16] = {
+    0x6e, 0xa2, 0x76, 0x72, 0x6c, 0x48, 0x7a, 0xb8, 0x5d, 0x27, 0xbd, 0x10, 0xdd, 0x84, 0x94, 0x01 };
+  static const uint8_t key[32] = {
+    0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+    0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10, 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef };
+  static const uint8_t pt[16] = {
+    0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x00, 0xff, 0xee, 0xdd, 0xcc, 0xbb, 0xaa, 0x99, 0x88 };
+  static const uint8_t ct[16] = {
+    0x7f, 0x67, 0x9d, 0x90, 0xbe, 0xbc, 0x24, 0x30, 0x5a, 0x46, 0x8d, 0x42, 0xb9, 0xd4, 0xed, 0xcd };
+  uint8_t rk[10][16], a[16], b[16], t[16], s[16];
+  int i, j;
+
+  if(memcmp(C[0], c1, 16) != 0)
+  {
+    return 0;
+  }
+
+  memcpy(a, key, 16);
+  memcpy(b, key + 16, 16);
+  memcpy(rk[0], a, 16);
+  memcpy(rk[1], b, 16);
+  for(i=0;i<32;i++)
+  {
+    memcpy(t, a, 16);
+    LSX(t, C[i]);
+    for(j=0;j<16;j++)
+    {
+      t[j] ^= b[j];
+    }
+    memcpy(b, a, 16);
+    memcpy(a, t, 16);
+    if((i & 7) == 7)
+    {
+      memcpy(rk[2 + i/4 - 1], a, 16);
+      memcpy(rk[2 + i/4], b, 16);
+    }
+  }
+
+  memcpy(s, pt, 16);
+  for(i=0;i<9;i++)
+  {
+    LSX(s, rk[i]);
+  }
+  for(j=0;j<16;j++)
+  {
+    s[j] ^= rk[9][j];
+  }
+  if(memcmp(s, ct, 16) != 0)
+  {
+    return 0;
+  }
+
+  // L^-1 must undo L
+  memcpy(t, ct, 16);
+  Lstep(t);
+  InvLstep(t);
+  return memcmp(t, ct, 16) == 0;
+}
+
+/*****************************************************************************/
+/* Output                                                                    */
+/*****************************************************************************/
+
+static void PrintBytes(const uint8_t* v, int n, const char* indent)
+{
+  int i;
+  for(i=0;i<n;i++)
+  {
+    printf("%s%3u%s", (i % 16) == 0 ? indent : "", v[i], i == n - 1 ? "" : (i % 16) == 15 ? ",\n" : ", ");
+  }
+}
+
+static void EmitRef(void)
+{
+  uint8_t m[256];
+  int r, x, i;
+
+  printf("/* Generated by gen_tables.c, do not edit. */\n\n");
+  printf("#ifndef KUZ_SBOX_VAR\n#define KUZ_SBOX_VAR\n#endif\n\n");
+
+  printf("KUZ_SBOX_VAR uint8_t sbox[256] = {\n");
+  PrintBytes(pi, 256, "  ");
+  printf(" };\n\n");
+  printf("KUZ_SBOX_VAR uint8_t rsbox[256] = {\n");
+  PrintBytes(rpi, 256, "  ");
+  printf(" };\n\n");
+
+  printf("// mult_mod_poly[r][x] = c.x for c =");
+  for(r=0;r<8;r++)
+  {
+    printf(" %u", rows[r]);
+  }
+  printf("\nstatic uint8_t mult_mod_poly[8][256] = {\n");
+  for(r=0;r<8;r++)
+  {
+    for(x=0;x<256;x++)
+    {
+      m[x] = gmul(rows[r], (uint8_t)x);
+    }
+    printf("  {\n");
+    PrintBytes(m, 256, "    ");
+    printf(" }%s\n", r == 7 ? "" : ",");
+  }
+  printf("};\n\n");
+
+  printf("// C[i] = L(i+1), key schedule constants\n");
+  printf("static uint8_t C[32][16] = {\n");
+  for(i=0;i<32;i++)
+  {
+    printf("  {");
+    for(x=0;x<16;x++)
+    {
+      printf("0x%02x%s", C[i][x], x == 15 ? "" : ", ");
+    }
+    printf("}%s\n", i == 31 ? "" : ",");
+  }
+  printf("};\n");
+}
+
+static void EmitLSTable(const char* name, const uint8_t* box, void (*step)(uint8_t*))
+{
+  uint8_t s[16];
+  int i, v, j;
+
+  printf("const lsblock_t %s[16][256] = {\n", name);
+  for(i=0;i<16;i++)
+  {
+    printf("  {\n");
+    for(v=0;v<256;v++)
+    {
+      memset(s, 0, 16);
+      s[i] = box[v];
+      step(s);
+      printf("    {{");
+      for(j=0;j<16;j++)
+      {
+        printf("0x%02x%s", s[j], j == 15 ? "" : ",");
+      }
+      printf("}}%s\n", v == 255 ? "" : ",");
+    }
+    printf("  }%s\n", i == 15 ? "" : ",");
+  }
+  printf("};\n\n");
+}
+
+static void EmitLS(void)
+{
+  printf("/* Generated by gen_tables.c, do not edit. */\n\n");
+  printf("// LS_enc[i][v] = L(S(v) placed at byte i of an all-zero state).\n");
+  EmitLSTable("LS_enc", pi, Lstep);
+  printf("// ILS_dec[i][v] = L^-1(S^-1(v) placed at byte i of an all-zero state).\n");
+  EmitLSTable("ILS_dec", rpi, InvLstep);
+}
+
+int main(int argc, char** argv)
+{
+  Build();
+  if(!Check())
+  {
+    fprintf(stderr, "gen_tables: self check against the standard failed\n");
+    return 1;
+  }
+
+  if(argc == 2 && strcmp(argv[1], "ref") == 0)
+  {
+    EmitRef();
+  }
+  else if(argc == 2 && strcmp(argv[1], "ls") == 0)
+  {
+    EmitLS();
+  }
+  else
+  {
+    fprintf(stderr, "usage: gen_tables ref|ls\n");
+    return 1;
+  }
+  return 0;
+}
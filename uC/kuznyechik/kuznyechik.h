@@ -4,6 +4,7 @@
 #define _KUZNYECHIK_H_
 
 #include <stdint.h>
+#include <stddef.h>
 
 #ifndef KUZNYECHIK_CONST_VAR
 //#define KUZNYECHIK_CONST_VAR static const
@@ -11,6 +12,86 @@
 #endif
 
 
+// The x86-64 kernels are built on the LS tables
+#if defined(KUZNYECHIK_SIMD) && !defined(KUZNYECHIK_LS_TABLES)
+#define KUZNYECHIK_LS_TABLES
+#endif
+
+// KUZNYECHIK_BITSLICE_ENGINE runs the kuz_ctx_* calls below on the
+// bitsliced engine, which it brings in
+#ifdef KUZNYECHIK_BITSLICE_ENGINE
+#ifdef KUZNYECHIK_LS_TABLES
+#error "KUZNYECHIK_BITSLICE_ENGINE replaces the LS tables, build with one of them"
+#endif
+#ifndef KUZNYECHIK_BITSLICE
+#define KUZNYECHIK_BITSLICE
+#endif
+#endif
+
+#define KUZ_BLOCK_SIZE 16
+#define KUZ_KEY_SIZE   32
+
+// Expanded key of one Kuznyechik instance. A context owns all of its key
+// material, so several keys or threads can be used at once without locking.
+typedef struct
+{
+  uint8_t rk[10][KUZ_BLOCK_SIZE];   // round keys K1..K10
+#ifdef KUZNYECHIK_LS_TABLES
+  uint8_t rkd[10][KUZ_BLOCK_SIZE];  // L^-1(rk), equivalent inverse cipher keys
+#endif
+} kuz_ctx_t;
+
+// Expand the 32-byte key into ctx. The key buffer is not referenced afterwards.
+// With KUZNYECHIK_SIMD the first call also selects the x86 kernel and builds
+// its constants, under pthread_once() : any thread may make it first.
+void kuz_ctx_init(kuz_ctx_t* ctx, const uint8_t* key);
+
+// Encrypt / decrypt one 16-byte block. in and out may be the same buffer.
+void kuz_encrypt(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out);
+void kuz_decrypt(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out);
+
+// Zero len bytes at p, a store the compiler cannot drop even when p is
+// about to die : for keys and keystream.
+void kuz_wipe(void* p, size_t len);
+
+// Erase the round keys of ctx once it is no longer needed.
+void kuz_ctx_wipe(kuz_ctx_t* ctx);
+
+// ECB over a run of consecutive blocks. With KUZNYECHIK_SIMD on x86-64 the
+// blocks go through the widest kernel the CPU supports (AVX2, SSE4.1), the
+// portable code otherwise; with KUZNYECHIK_BITSLICE_ENGINE KUZ_BS_BLOCKS at a
+// time. in and out may be the same buffer.
+void kuz_encrypt_blocks(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out, size_t blocks);
+void kuz_decrypt_blocks(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out, size_t blocks);
+
+#ifdef KUZNYECHIK_BITSLICE
+
+// Bitsliced engine (kuznyechik_bitslice.c) : constant time, KUZ_BS_BLOCKS
+// blocks per pass. KUZNYECHIK_BITSLICE_WIDTH is 64 (uint64_t slices),
+// 128 or 256 (GCC vectors, SSE2 / AVX2 registers).
+#ifndef KUZNYECHIK_BITSLICE_WIDTH
+#define KUZNYECHIK_BITSLICE_WIDTH 64
+#endif
+#define KUZ_BS_BLOCKS KUZNYECHIK_BITSLICE_WIDTH
+
+// Derive the L circuits and the key schedule constants from the reference
+// code. Run once per process (pthread_once) by the first kuz_bs_* call,
+// from any thread.
+void kuz_bs_init(void);
+
+// kuz_ctx_init() without tables : the key schedule in constant time, the
+// same round keys.
+void kuz_bs_ctx_init(kuz_ctx_t* ctx, const uint8_t* key);
+
+// ECB over any number of blocks, the last group is padded internally.
+void kuz_bs_encrypt(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out, size_t blocks);
+void kuz_bs_decrypt(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out, size_t blocks);
+
+#endif // KUZNYECHIK_BITSLICE
+
+// Historical single-key API, working in place on a context private to
+// kuznyechik.c (not reentrant).
+
 //void kuznyechik_encrypt(uint8_t* input, uint8_t* key, uint8_t *output);
 //void kuznyechik_decrypt(uint8_t* input, uint8_t* key, uint8_t *output);
 
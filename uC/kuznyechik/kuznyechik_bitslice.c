@@ -0,0 +1,634 @@
+/* Bitsliced Kuznyechik engine : KUZ_BS_BLOCKS blocks per pass, constant time. */
+
+/*
+
+The state of KUZ_BS_BLOCKS blocks is kept as 128 slices : slice 8*i+b holds
+bit b of byte i of every block, block n in bit n of the slice. A slice is
+one uint64_t, or a GCC vector of 2 / 4 of them when
+KUZNYECHIK_BITSLICE_WIDTH is 128 / 256 (SSE2 / AVX2 registers).
+
+  S : the decomposition of pi found by Biryukov, Perrin and Udovenko
+      ("Reverse-engineering the S-box of Streebog, Kuznyechik and
+      STRIBOBr1", Eurocrypt 2016). With a = alpha(x) split in nibbles
+      l || r and products in GF(16) = GF(2)[x] / (x^4 + x^3 + 1) :
+
+        l' = r == 0 ? nu0(l) : nu1(l * r^-1)
+        r' = sigma(r * phi(l'))
+        pi(x) = omega(l' || r')
+
+      alpha and omega are linear, the 4-bit functions are evaluated from
+      their algebraic normal form : about 300 AND/XOR per S-box instead of
+      the 1279 of the ANF of pi itself. pi^-1 takes the same path backwards.
+  L : the 128x128 binary matrix of Lstep() (resp. InvLstep()), taken from
+      the images of the 128 unit states by kuz_bs_init() (pthread_once).
+      The input slices are cut in 32 nibbles; all 16 XOR combinations of
+      each nibble are computed once, then every output slice is the XOR of
+      at most 32 of them (Four Russians) : about 4300 XOR instead of 8100.
+
+Blocks go in and out of slices by 64x64 bit-matrix transposes (6 stages of
+masks and shifts over 64-bit words), and the round keys are spread into
+all-ones / all-zeroes masks once per call.
+
+Every slice goes through the same fixed sequence of AND/XOR whatever the
+data and key are : no table is indexed by secret values, the engine can be
+used as a leakage-free reference. kuz_bs_ctx_init() runs the 32 Feistel
+steps of the key schedule on one block at a time without tables either :
+the 16 bytes of the state as 8 slices of 16 bits through the same S circuit,
+L as the XOR of its matrix columns under all-ones / all-zeroes masks.
+
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <pthread.h>
+#include "kuznyechik.h"
+#include "kuznyechik_internal.h"
+
+#ifdef KUZNYECHIK_BITSLICE
+
+#define SLICES 128
+#define NIBBLES (SLICES/4)
+#define BS_LANES (KUZNYECHIK_BITSLICE_WIDTH/64)
+
+typedef uint64_t bsword_t __attribute__((vector_size(8*BS_LANES)));
+
+#define INLINE static inline __attribute__((always_inline))
+
+// One L circuit : output slice o is the XOR of the entries src[o][] of the
+// nibble table of BsLstep(), entry 16*n + v being the XOR of the slices of
+// nibble n selected by v.
+typedef struct
+{
+  uint8_t  count[SLICES];
+  uint16_t src[SLICES][NIBBLES];
+} bs_lmap_t;
+
+static bs_lmap_t L_enc, L_dec;
+static uint64_t Lcol_enc[SLICES][2];        // L(unit state s), key schedule
+#ifdef KUZNYECHIK_LS_TABLES
+static uint64_t Lcol_dec[SLICES][2];        // L^-1(unit state s), rkd
+#endif
+static uint8_t C_bs[32][KUZ_BLOCK_SIZE];    // key schedule constants L(i)
+static pthread_once_t bsOnce = PTHREAD_ONCE_INIT;
+
+/*****************************************************************************/
+/* S circuit                                                                 */
+/*****************************************************************************/
+
+// Linear maps of the decomposition : column i is the image of input bit i.
+static const uint8_t Alpha[8]    = { 0x70, 0x3a, 0x14, 0x9a, 0x02, 0x11, 0x74, 0x18 };
+static const uint8_t Omega[8]    = { 0x01, 0x92, 0x44, 0x98, 0x10, 0x20, 0x04, 0x12 };
+static const uint8_t InvAlpha[8] = { 0x65, 0x10, 0x41, 0xc5, 0x45, 0x92, 0xd6, 0x98 };
+static const uint8_t InvOmega[8] = { 0x01, 0x90, 0x40, 0x9a, 0x10, 0x20, 0x44, 0x82 };
+
+// 4-bit functions as the ANF of their output bits : bit u of anf[j] set if
+// the product of the input bits in u is a term of output bit j (u = 0 is
+// the constant 1). From the tables of the paper :
+//
+//   nu0   = 2 5 3 b 6 9 e a 0 4 f 1 8 d c 7
+//   nu1   = 7 6 c 9 0 f 8 1 4 5 b e d 2 3 a
+//   phi   = b 2 b 8 c 4 1 c 6 3 5 8 e 3 6 b
+//   sigma = c d 0 4 8 b a e 3 9 5 2 f 1 6 7
+//
+// plus x^-1 in GF(16) (0 for 0) and the inverses used by pi^-1.
+static const uint16_t InvAnf[4]      = { 0x730a, 0x5bd0, 0x36dc, 0x2a64 };
+static const uint16_t Nu0Anf[4]      = { 0x2a4e, 0x470b, 0x1c9a, 0x3468 };
+static const uint16_t Nu1Anf[4]      = { 0x0157, 0x51f5, 0x1439, 0x1024 };
+static const uint16_t PhiAnf[4]      = { 0xb5f3, 0xdc99, 0xd3d0, 0x33cb };
+static const uint16_t SigmaAnf[4]    = { 0x430a, 0x27e0, 0x215d, 0x1f45 };
+static const uint16_t InvSigmaAnf[4] = { 0x5416, 0x2f23, 0x11ea, 0x240e };
+static const uint16_t InvPhiAnf[4]   = { 0xfc48, 0x5f6b, 0x090a, 0xdf99 };  // phi^-1 then x^-1
+static const uint16_t InvNu0Anf[4]   = { 0x347a, 0x56a2, 0x4940, 0x0a25 };
+static const uint16_t InvNu1Anf[4]   = { 0x2006, 0x0322, 0x0211, 0x3014 };
+
+// The loops below run over constants only : unrolled, they leave the bare
+// AND/XOR sequence of each function.
+
+// y = M.x, column i of M in cols[i]
+INLINE void Linear8(bsword_t* y, const bsword_t* x, const uint8_t* cols)
+{
+  uint8_t i, j;
+
+#pragma GCC unroll 8
+  for(j=0;j<8;j++)
+  {
+    y[j] = (bsword_t){0};
+#pragma GCC unroll 8
+    for(i=0;i<8;i++)
+    {
+      if((cols[i] >> j) & 1)
+      {
+        y[j] ^= x[i];
+      }
+    }
+  }
+}
+
+// y = f(x) on one nibble, f given by its ANF
+INLINE void Nibble(bsword_t* y, const bsword_t* x, const uint16_t* anf)
+{
+  bsword_t m[16];
+  uint8_t u, j;
+
+  // m[u] = AND of the bits of x in u, from m[u minus its lowest bit]
+  m[0] = ~(bsword_t){0};
+#pragma GCC unroll 16
+  for(u=1;u<16;u++)
+  {
+    m[u] = (u & (u - 1)) == 0 ? x[__builtin_ctz(u)] : m[u & (u - 1)] & x[__builtin_ctz(u)];
+  }
+#pragma GCC unroll 4
+  for(j=0;j<4;j++)
+  {
+    y[j] = (bsword_t){0};
+#pragma GCC unroll 16
+    for(u=0;u<16;u++)
+    {
+      if((anf[j] >> u) & 1)
+      {
+        y[j] ^= m[u];
+      }
+    }
+  }
+}
+
+// z = a.b in GF(16) : schoolbook product, then x^k = x^(k-1) + x^(k-4)
+INLINE void GfMul(bsword_t* z, const bsword_t* a, const bsword_t* b)
+{
+  bsword_t p[7];
+  int8_t i, j;
+
+#pragma GCC unroll 7
+  for(i=0;i<7;i++)
+  {
+    p[i] = (bsword_t){0};
+  }
+#pragma GCC unroll 4
+  for(i=0;i<4;i++)
+  {
+#pragma GCC unroll 4
+    for(j=0;j<4;j++)
+    {
+      p[i + j] ^= a[i] & b[j];
+    }
+  }
+#pragma GCC unroll 3
+  for(i=6;i>=4;i--)
+  {
+    p[i - 1] ^= p[i];
+    p[i - 4] ^= p[i];
+  }
+  memcpy(z, p, 4*sizeof(bsword_t));
+}
+
+// x[0..7] = pi(x[0..7])
+static void BsSbox(bsword_t* x)
+{
+  bsword_t a[8], y[8], inv[4], t[4], n0[4], f[4], u[4];
+  bsword_t zero;
+  uint8_t j;
+
+  Linear8(a, x, Alpha);                     // r in a[0..3], l in a[4..7]
+  zero = ~(a[0] | a[1] | a[2] | a[3]);
+
+  // l' = r == 0 ? nu0(l) : nu1(l.r^-1)
+  Nibble(inv, a, InvAnf);
+  GfMul(t, a + 4, inv);
+  Nibble(y + 4, t, Nu1Anf);
+  Nibble(n0, a + 4, Nu0Anf);
+  for(j=0;j<4;j++)
+  {
+    y[4 + j] ^= zero & (n0[j] ^ y[4 + j]);
+  }
+
+  // r' = sigma(r.phi(l'))
+  Nibble(f, y + 4, PhiAnf);
+  GfMul(u, a, f);
+  Nibble(y, u, SigmaAnf);
+  Linear8(x, y, Omega);
+}
+
+// x[0..7] = pi^-1(x[0..7])
+static void BsInvSbox(bsword_t* x)
+{
+  bsword_t a[8], v[8], u[4], g[4], n0[4], n1[4];
+  bsword_t zero;
+  uint8_t j;
+
+  Linear8(v, x, InvOmega);                  // r' in v[0..3], l' in v[4..7]
+
+  // r = sigma^-1(r').phi(l')^-1
+  Nibble(u, v, InvSigmaAnf);
+  Nibble(g, v + 4, InvPhiAnf);
+  GfMul(a, u, g);
+  zero = ~(a[0] | a[1] | a[2] | a[3]);
+
+  // l = r == 0 ? nu0^-1(l') : nu1^-1(l').r, the product being 0 for r == 0
+  Nibble(n1, v + 4, InvNu1Anf);
+  GfMul(a + 4, n1, a);
+  Nibble(n0, v + 4, InvNu0Anf);
+  for(j=0;j<4;j++)
+  {
+    a[4 + j] ^= zero & n0[j];
+  }
+  Linear8(x, a, InvAlpha);
+}
+
+/*****************************************************************************/
+/* L circuits                                                                */
+/*****************************************************************************/
+
+static void LinearCircuit(bs_lmap_t* c, uint64_t (*col)[2], void (*step)(uint8_t*))
+{
+  uint8_t column[SLICES][KUZ_BLOCK_SIZE];
+  uint8_t in, out, n, v;
+
+  for(in=0;in<SLICES;in++)
+  {
+    memset(column[in], 0, KUZ_BLOCK_SIZE);
+    column[in][in >> 3] = (uint8_t)(1 << (in & 7));
+    step(column[in]);
+    if(col != NULL)
+    {
+      memcpy(col[in], column[in], KUZ_BLOCK_SIZE);
+    }
+  }
+  for(out=0;out<SLICES;out++)
+  {
+    c->count[out] = 0;
+    for(n=0;n<NIBBLES;n++)
+    {
+      // v : the input slices of nibble n that output slice out depends on
+      v = 0;
+      for(in=0;in<4;in++)
+      {
+        v |= ((column[4*n + in][out >> 3] >> (out & 7)) & 1) << in;
+      }
+      if(v != 0)
+      {
+        c->src[out][c->count[out]++] = (uint16_t)(16*n + v);
+      }
+    }
+  }
+}
+
+static void BsInit(void)
+{
+  uint8_t i;
+
+  LinearCircuit(&L_enc, Lcol_enc, kuz_lstep);
+#ifdef KUZNYECHIK_LS_TABLES
+  LinearCircuit(&L_dec, Lcol_dec, kuz_inv_lstep);
+#else
+  LinearCircuit(&L_dec, NULL, kuz_inv_lstep);
+#endif
+  for(i=0;i<32;i++)
+  {
+    memset(C_bs[i], 0, KUZ_BLOCK_SIZE);
+    C_bs[i][KUZ_BLOCK_SIZE - 1] = (uint8_t)(i + 1);
+    kuz_lstep(C_bs[i]);
+  }
+}
+
+void kuz_bs_init(void)
+{
+  pthread_once(&bsOnce, BsInit);
+}
+
+/*****************************************************************************/
+/* Bitsliced steps                                                           */
+/*****************************************************************************/
+
+static void BsAddRoundKey(bsword_t* w, const uint64_t* mask)
+{
+  uint8_t s;
+  for(s=0;s<SLICES;s++)
+  {
+    w[s] ^= mask[s];
+  }
+}
+
+static void BsSstep(bsword_t* w)
+{
+  uint8_t i;
+  for(i=0;i<16;i++)
+  {
+    BsSbox(w + 8*i);
+  }
+}
+
+static void BsInvSstep(bsword_t* w)
+{
+  uint8_t i;
+  for(i=0;i<16;i++)
+  {
+    BsInvSbox(w + 8*i);
+  }
+}
+
+static void BsLstep(bsword_t* w, const bs_lmap_t* c)
+{
+  bsword_t t[16*NIBBLES];
+  bsword_t y;
+  uint8_t n, v, o, k;
+
+  for(n=0;n<NIBBLES;n++)
+  {
+    t[16*n] = (bsword_t){0};
+    for(v=1;v<16;v++)
+    {
+      t[16*n + v] = t[16*n + (v & (v - 1))] ^ w[4*n + __builtin_ctz(v)];
+    }
+  }
+  for(o=0;o<SLICES;o++)
+  {
+    y = (bsword_t){0};
+    for(k=0;k<c->count[o];k++)
+    {
+      y ^= t[c->src[o][k]];
+    }
+    w[o] = y;
+  }
+}
+
+/*****************************************************************************/
+/* Transposition                                                             */
+/*****************************************************************************/
+
+static uint64_t Load64(const uint8_t* p)
+{
+  uint64_t v;
+  memcpy(&v, p, 8);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  v = __builtin_bswap64(v);
+#endif
+  return v;
+}
+
+static void Store64(uint8_t* p, uint64_t v)
+{
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  v = __builtin_bswap64(v);
+#endif
+  memcpy(p, &v, 8);
+}
+
+// Bit c of a[r] <-> bit r of a[c], in every lane : stage j swaps bit j of
+// the row and column numbers.
+static void Transpose64(bsword_t* a)
+{
+  static const uint64_t mask[6] = {
+    0x00000000ffffffffULL, 0x0000ffff0000ffffULL, 0x00ff00ff00ff00ffULL,
+    0x0f0f0f0f0f0f0f0fULL, 0x3333333333333333ULL, 0x5555555555555555ULL
+  };
+  bsword_t t;
+  uint8_t j, k, s;
+
+  for(j=32,s=0;j>0;j>>=1,s++)
+  {
+    for(k=0;k<64;k++)
+    {
+      if((k & j) == 0)
+      {
+        t = ((a[k] >> j) ^ a[k + j]) & mask[s];
+        a[k + j] ^= t;
+        a[k] ^= t << j;
+      }
+    }
+  }
+}
+
+// Half h of every block (bytes 8h..8h+7, slices 64h..64h+63) : block
+// 64*lane + n is row n of lane lane. Missing blocks of the last group are
+// zero : they are computed and dropped.
+static void ToSlices(bsword_t* w, const uint8_t* in, size_t blocks)
+{
+  size_t n, lane, b;
+  uint8_t h;
+
+  for(h=0;h<2;h++)
+  {
+    bsword_t* a = w + 64*h;
+    for(n=0;n<64;n++)
+    {
+      for(lane=0;lane<BS_LANES;lane++)
+      {
+        b = 64*lane + n;
+        a[n][lane] = b < blocks ? Load64(in + b*KUZ_BLOCK_SIZE + 8*h) : 0;
+      }
+    }
+    Transpose64(a);
+  }
+}
+
+static void FromSlices(uint8_t* out, const bsword_t* w, size_t blocks)
+{
+  bsword_t a[64];
+  size_t n, lane, b;
+  uint8_t h;
+
+  for(h=0;h<2;h++)
+  {
+    memcpy(a, w + 64*h, sizeof(a));
+    Transpose64(a);
+    for(n=0;n<64;n++)
+    {
+      for(lane=0;lane<BS_LANES;lane++)
+      {
+        b = 64*lane + n;
+        if(b < blocks)
+        {
+          Store64(out + b*KUZ_BLOCK_SIZE + 8*h, a[n][lane]);
+        }
+      }
+    }
+  }
+}
+
+// Round keys as all-ones / all-zeroes masks, one per slice
+static void KeyMasks(uint64_t (*mask)[SLICES], const kuz_ctx_t* ctx)
+{
+  uint8_t r, s;
+  for(r=0;r<10;r++)
+  {
+    for(s=0;s<SLICES;s++)
+    {
+      mask[r][s] = 0 - (uint64_t)((ctx->rk[r][s >> 3] >> (s & 7)) & 1);
+    }
+  }
+}
+
+/*****************************************************************************/
+/* Key schedule                                                              */
+/*****************************************************************************/
+
+// Bit c of byte r <-> bit r of byte c of one 64-bit word
+static uint64_t Transpose8(uint64_t x)
+{
+  uint64_t t;
+  t = (x ^ (x >> 7)) & 0x00aa00aa00aa00aaULL;
+  x ^= t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000cccc0000ccccULL;
+  x ^= t ^ (t << 14);
+  t = (x ^ (x >> 28)) & 0x00000000f0f0f0f0ULL;
+  x ^= t ^ (t << 28);
+  return x;
+}
+
+// S of one block : slice b holds bit b of the 16 bytes in bits 0..15
+static void BlockSstep(uint8_t* state)
+{
+  bsword_t x[8];
+  uint64_t lo = Transpose8(Load64(state));
+  uint64_t hi = Transpose8(Load64(state + 8));
+  uint8_t b;
+
+  for(b=0;b<8;b++)
+  {
+    x[b] = (bsword_t){0} + (((lo >> 8*b) & 0xff) | ((hi >> 8*b) & 0xff) << 8);
+  }
+  BsSbox(x);
+  lo = hi = 0;
+  for(b=0;b<8;b++)
+  {
+    lo |= (x[b][0] & 0xff) << 8*b;
+    hi |= ((x[b][0] >> 8) & 0xff) << 8*b;
+  }
+  Store64(state, Transpose8(lo));
+  Store64(state + 8, Transpose8(hi));
+  kuz_wipe(x, sizeof(x));
+}
+
+// L (or L^-1) of one block : the XOR of the columns of its matrix selected
+// by the state bits, under masks rather than branches
+static void BlockLstep(uint8_t* state, const uint64_t (*col)[2])
+{
+  uint64_t q[2], y[2] = { 0, 0 }, m;
+  uint8_t s;
+
+  q[0] = Load64(state);
+  q[1] = Load64(state + 8);
+  for(s=0;s<SLICES;s++)
+  {
+    m = 0 - ((q[s >> 6] >> (s & 63)) & 1);
+    y[0] ^= col[s][0] & m;
+    y[1] ^= col[s][1] & m;
+  }
+  Store64(state, y[0]);
+  Store64(state + 8, y[1]);
+}
+
+/*****************************************************************************/
+/* Public functions:                                                         */
+/*****************************************************************************/
+
+void kuz_bs_ctx_init(kuz_ctx_t* ctx, const uint8_t* key)
+{
+  kuz_bs_key_expansion(ctx, key, (const uint8_t (*)[KUZ_BLOCK_SIZE])C_bs);
+}
+
+// (a, b) <- (L(S(a ^ c[i])) ^ b, a) as in KeyExpansion()
+void kuz_bs_key_expansion(kuz_ctx_t* ctx, const uint8_t* key, const uint8_t (*c)[KUZ_BLOCK_SIZE])
+{
+  uint8_t a[KUZ_BLOCK_SIZE], b[KUZ_BLOCK_SIZE], t[KUZ_BLOCK_SIZE];
+  uint8_t i, j;
+
+  kuz_bs_init();
+  memcpy(a, key, KUZ_BLOCK_SIZE);
+  memcpy(b, key + KUZ_BLOCK_SIZE, KUZ_BLOCK_SIZE);
+  memcpy(ctx->rk[0], a, KUZ_BLOCK_SIZE);
+  memcpy(ctx->rk[1], b, KUZ_BLOCK_SIZE);
+
+  for(i=0;i<32;i++)
+  {
+    for(j=0;j<KUZ_BLOCK_SIZE;j++)
+    {
+      t[j] = a[j] ^ c[i][j];
+    }
+    BlockSstep(t);
+    BlockLstep(t, (const uint64_t (*)[2])Lcol_enc);
+    for(j=0;j<KUZ_BLOCK_SIZE;j++)
+    {
+      t[j] ^= b[j];
+    }
+    memcpy(b, a, KUZ_BLOCK_SIZE);
+    memcpy(a, t, KUZ_BLOCK_SIZE);
+
+    if((i & 7) == 7)
+    {
+      memcpy(ctx->rk[(i >> 2) + 1], a, KUZ_BLOCK_SIZE);
+      memcpy(ctx->rk[(i >> 2) + 2], b, KUZ_BLOCK_SIZE);
+    }
+  }
+
+#ifdef KUZNYECHIK_LS_TABLES
+  // rkd = L^-1(rk) for kuz_decrypt()
+  for(i=0;i<10;i++)
+  {
+    memcpy(ctx->rkd[i], ctx->rk[i], KUZ_BLOCK_SIZE);
+    BlockLstep(ctx->rkd[i], (const uint64_t (*)[2])Lcol_dec);
+  }
+#endif
+  kuz_wipe(a, sizeof(a));
+  kuz_wipe(b, sizeof(b));
+  kuz_wipe(t, sizeof(t));
+}
+
+void kuz_bs_encrypt(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out, size_t blocks)
+{
+  bsword_t w[SLICES];
+  uint64_t rk[10][SLICES];
+  size_t group;
+  uint8_t round;
+
+  kuz_bs_init();
+  KeyMasks(rk, ctx);
+  for(; blocks > 0; blocks -= group)
+  {
+    group = blocks < KUZ_BS_BLOCKS ? blocks : KUZ_BS_BLOCKS;
+    ToSlices(w, in, group);
+    for(round = 0; round < 9; round++)
+    {
+      BsAddRoundKey(w, rk[round]);
+      BsSstep(w);
+      BsLstep(w, &L_enc);
+    }
+    BsAddRoundKey(w, rk[9]);
+    FromSlices(out, w, group);
+    in += group*KUZ_BLOCK_SIZE;
+    out += group*KUZ_BLOCK_SIZE;
+  }
+  kuz_wipe(rk, sizeof(rk));
+  kuz_wipe(w, sizeof(w));
+}
+
+void kuz_bs_decrypt(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out, size_t blocks)
+{
+  bsword_t w[SLICES];
+  uint64_t rk[10][SLICES];
+  size_t group;
+  uint8_t round;
+
+  kuz_bs_init();
+  KeyMasks(rk, ctx);
+  for(; blocks > 0; blocks -= group)
+  {
+    group = blocks < KUZ_BS_BLOCKS ? blocks : KUZ_BS_BLOCKS;
+    ToSlices(w, in, group);
+    for(round = 9; round > 0; round--)
+    {
+      BsAddRoundKey(w, rk[round]);
+      BsLstep(w, &L_dec);
+      BsInvSstep(w);
+    }
+    BsAddRoundKey(w, rk[0]);
+    FromSlices(out, w, group);
+    in += group*KUZ_BLOCK_SIZE;
+    out += group*KUZ_BLOCK_SIZE;
+  }
+  kuz_wipe(rk, sizeof(rk));
+  kuz_wipe(w, sizeof(w));
+}
+
+#endif // KUZNYECHIK_BITSLICE
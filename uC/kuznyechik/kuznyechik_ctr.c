@@ -0,0 +1,181 @@
+/* CTR mode of GOST R 34.13-2015 (section 5.2) for Kuznyechik. */
+
+/*
+
+Test vector (GOST R 34.13-2015, A.1.2), with the key of kuznyechik.c :
+
+  IV : 1234567890abcef0
+  P1 : 1122334455667700ffeeddccbbaa9988  ->  C1 : f195d8bec10ed1dbd57b5fa240bda1b8
+  P2 : 00112233445566778899aabbcceeff0a  ->  C2 : 85eee733f6a13e5df33ce4b33c45dee4
+
+CTR-ACPKM (R 1323565.1.017-2018) is the same keystream, with the key replaced
+every section of N bytes by
+
+  K' = E_K(80 81 .. 8f) || E_K(90 91 .. 9f)
+
+and the counter running on across sections. The new key goes through
+kuz_ctx_init(), i.e. the LS-tables or GFNI key schedule of the engine.
+
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include "kuznyechik.h"
+#include "kuznyechik_modes.h"
+
+// Big-endian increment of the whole block, mod 2^128
+static void CounterIncrement(uint8_t* ctr)
+{
+  int8_t i;
+  for(i=KUZ_BLOCK_SIZE-1;i>=0;i--)
+  {
+    if(++ctr[i] != 0)
+    {
+      break;
+    }
+  }
+}
+
+// ctr = (IV || 0^64) + first, mod 2^128
+static void CounterInit(uint8_t* ctr, const uint8_t* iv, uint64_t first)
+{
+  uint16_t sum;
+  int8_t i;
+
+  memcpy(ctr, iv, KUZ_CTR_IV_SIZE);
+  memset(ctr + KUZ_CTR_IV_SIZE, 0, KUZ_BLOCK_SIZE - KUZ_CTR_IV_SIZE);
+  sum = 0;
+  for(i=KUZ_BLOCK_SIZE-1;i>=0;i--)
+  {
+    sum += ctr[i] + (uint8_t)first;
+    ctr[i] = (uint8_t)sum;
+    sum >>= 8;
+    first >>= 8;
+  }
+}
+
+void kuz_ctr_xor(const kuz_ctx_t* ctx, const uint8_t* iv, const uint8_t* in, uint8_t* out, size_t len)
+{
+  kuz_ctr_xor_from(ctx, iv, 0, in, out, len);
+}
+
+// out = in ^ keystream from counter ctr, which is left on the next block
+static void Keystream(const kuz_ctx_t* ctx, uint8_t* ctr, const uint8_t* in, uint8_t* out, size_t len)
+{
+  uint8_t stream[KUZ_CTR_BATCH*KUZ_BLOCK_SIZE];
+  size_t blocks, bytes, i, used = 0;
+
+  while(len > 0)
+  {
+    // Lay out the counters of a whole batch, then encrypt them in one call
+    blocks = (len + KUZ_BLOCK_SIZE - 1) / KUZ_BLOCK_SIZE;
+    if(blocks > KUZ_CTR_BATCH)
+    {
+      blocks = KUZ_CTR_BATCH;
+    }
+    used = blocks > used ? blocks : used;
+    for(i=0;i<blocks;i++)
+    {
+      memcpy(stream + i*KUZ_BLOCK_SIZE, ctr, KUZ_BLOCK_SIZE);
+      CounterIncrement(ctr);
+    }
+    kuz_encrypt_blocks(ctx, stream, stream, blocks);
+
+    bytes = blocks*KUZ_BLOCK_SIZE < len ? blocks*KUZ_BLOCK_SIZE : len;
+    for(i=0;i<bytes;i++)
+    {
+      out[i] = in[i] ^ stream[i];
+    }
+    in += bytes;
+    out += bytes;
+    len -= bytes;
+  }
+  kuz_wipe(stream, used*KUZ_BLOCK_SIZE);
+}
+
+void kuz_ctr_xor_from(const kuz_ctx_t* ctx, const uint8_t* iv, uint64_t first, const uint8_t* in, uint8_t* out, size_t len)
+{
+  uint8_t ctr[KUZ_BLOCK_SIZE];
+
+  CounterInit(ctr, iv, first);
+  Keystream(ctx, ctr, in, out, len);
+}
+
+/*****************************************************************************/
+/* CTR-ACPKM                                                                 */
+/*****************************************************************************/
+
+// Replace the key of st by the ACPKM transform of itself
+static void Mesh(kuz_acpkm_t* st)
+{
+  uint8_t d[KUZ_KEY_SIZE];
+  uint8_t i;
+
+  for(i=0;i<KUZ_KEY_SIZE;i++)
+  {
+    d[i] = (uint8_t)(0x80 + i);
+  }
+  kuz_encrypt_blocks(&st->ctx, d, d, KUZ_KEY_SIZE/KUZ_BLOCK_SIZE);
+  kuz_ctx_init(&st->ctx, d);
+  kuz_wipe(d, KUZ_KEY_SIZE);
+}
+
+int kuz_acpkm_init(kuz_acpkm_t* st, const kuz_ctx_t* ctx, const uint8_t* iv, size_t section)
+{
+  if(section == 0 || section % KUZ_BLOCK_SIZE != 0)
+  {
+    return -1;
+  }
+  memcpy(&st->ctx, ctx, sizeof(kuz_ctx_t));
+  CounterInit(st->ctr, iv, 0);
+  st->section = section;
+  st->used = 0;
+  st->kslen = 0;
+  return 0;
+}
+
+void kuz_acpkm_xor(kuz_acpkm_t* st, const uint8_t* in, uint8_t* out, size_t len)
+{
+  size_t bytes, whole, i;
+
+  // Rest of the keystream block started by the previous call
+  for(; st->kslen > 0 && len > 0; len--)
+  {
+    *out++ = *in++ ^ st->ks[KUZ_BLOCK_SIZE - st->kslen--];
+  }
+
+  while(len > 0)
+  {
+    if(st->used == st->section)
+    {
+      Mesh(st);
+      st->used = 0;
+    }
+    bytes = st->section - st->used < len ? st->section - st->used : len;
+    whole = bytes - bytes % KUZ_BLOCK_SIZE;
+    Keystream(&st->ctx, st->ctr, in, out, whole);
+    st->used += whole;
+    in += whole;
+    out += whole;
+    len -= whole;
+
+    // A partial block ends the call : keep its keystream
+    if(bytes != whole)
+    {
+      kuz_encrypt(&st->ctx, st->ctr, st->ks);
+      CounterIncrement(st->ctr);
+      st->used += KUZ_BLOCK_SIZE;
+      for(i=0;i<len;i++)
+      {
+        out[i] = in[i] ^ st->ks[i];
+      }
+      st->kslen = (uint8_t)(KUZ_BLOCK_SIZE - len);
+      len = 0;
+    }
+  }
+}
+
+void kuz_acpkm_wipe(kuz_acpkm_t* st)
+{
+  kuz_wipe(st, sizeof(kuz_acpkm_t));
+}
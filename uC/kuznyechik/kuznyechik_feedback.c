@@ -0,0 +1,233 @@
+/* CBC, CFB and OFB modes of GOST R 34.13-2015 (sections 5.3 - 5.5) for Kuznyechik. */
+
+/*
+
+The three modes keep a register R of z blocks (m = z.n bits), initialised
+with the IV; the caller's iv buffer is that register and is updated by every
+call, so a message can be processed in several calls. Block i is chained to
+block i - z :
+
+  CBC : C(i) = E(P(i) ^ C(i-z))       P(i) = D(C(i)) ^ C(i-z)
+  CFB : C(i) = P(i) ^ E(C(i-z))       P(i) = C(i) ^ E(C(i-z))
+  OFB : Y(i) = E(Y(i-z)), C(i) = P(i) ^ Y(i)
+
+with C(-z)..C(-1) (resp. Y) the IV blocks. Segments are whole blocks (s = n).
+
+Everything works in place over the caller's buffers :
+
+  - CBC/CFB encryption and OFB are serial along a chain, but the z chains
+    are independent : each kuz_encrypt_blocks() call runs z blocks.
+  - CBC/CFB decryption has every input at hand : batches of KUZ_CTR_BATCH
+    blocks (plus the z register blocks for CFB) go through
+    kuz_decrypt_blocks() / kuz_encrypt_blocks() into a stack buffer. CBC
+    XORs them back from the last block to the first, so that C(i-z) is read
+    before block i-z is overwritten.
+
+Test vectors (GOST R 34.13-2015, A.1.3 - A.1.5), key and plaintext of the
+CTR example, z = 2 :
+
+  IV  : 1234567890abcef0a1b2c3d4e5f0011223344556677889901213141516171819
+  OFB : 81800a59b1842b24ff1f795e897abd95 ed5b47a7048cfab48fb521369d9326bf
+        66a257ac3ca0b8b1c80fe7fc10288a13 203ebbc066138660a0292243f6903150
+  CBC : 689972d4a085fa4d90e52e3d6d7dcc27 2826e661b478eca6af1e8e448d5ea5ac
+        fe7babf1e91999e85640e8b0f49d90d0 167688065a895c631a2d9a1560b63970
+  CFB : 81800a59b1842b24ff1f795e897abd95 ed5b47a7048cfab48fb521369d9326bf
+        79f2a8eb5cc68d38842d264e97a238b5 4ffebecd4e922de6c75bd9dd44fbf4d1
+
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include "kuznyechik.h"
+#include "kuznyechik_modes.h"
+
+#define MAX_REG (KUZ_IV_MAX_BLOCKS*KUZ_BLOCK_SIZE)
+
+static void Xor(uint8_t* out, const uint8_t* a, const uint8_t* b, size_t len)
+{
+  size_t i;
+  for(i=0;i<len;i++)
+  {
+    out[i] = a[i] ^ b[i];
+  }
+}
+
+// z blocks of register from a length in bytes, 0 if not supported
+static size_t RegisterBlocks(size_t ivlen)
+{
+  if(ivlen == 0 || ivlen > MAX_REG || ivlen % KUZ_BLOCK_SIZE != 0)
+  {
+    return 0;
+  }
+  return ivlen / KUZ_BLOCK_SIZE;
+}
+
+// reg = last z blocks of (reg || blocks[0..n-1])
+static void Shift(uint8_t* reg, size_t z, const uint8_t* blocks, size_t n)
+{
+  if(n >= z)
+  {
+    memcpy(reg, blocks + (n - z)*KUZ_BLOCK_SIZE, z*KUZ_BLOCK_SIZE);
+  }
+  else
+  {
+    memmove(reg, reg + n*KUZ_BLOCK_SIZE, (z - n)*KUZ_BLOCK_SIZE);
+    memcpy(reg + (z - n)*KUZ_BLOCK_SIZE, blocks, n*KUZ_BLOCK_SIZE);
+  }
+}
+
+/*****************************************************************************/
+/* CBC                                                                       */
+/*****************************************************************************/
+
+int kuz_cbc_encrypt(const kuz_ctx_t* ctx, uint8_t* iv, size_t ivlen, const uint8_t* in, uint8_t* out, size_t blocks)
+{
+  size_t z = RegisterBlocks(ivlen);
+  size_t i, n;
+
+  if(z == 0)
+  {
+    return -1;
+  }
+  // One block of each chain per call : out(i) = E(in(i) ^ C(i-z))
+  for(i=0;i<blocks;i+=n)
+  {
+    n = blocks - i < z ? blocks - i : z;
+    Xor(out + i*KUZ_BLOCK_SIZE, in + i*KUZ_BLOCK_SIZE,
+        i == 0 ? iv : out + (i - z)*KUZ_BLOCK_SIZE, n*KUZ_BLOCK_SIZE);
+    kuz_encrypt_blocks(ctx, out + i*KUZ_BLOCK_SIZE, out + i*KUZ_BLOCK_SIZE, n);
+  }
+  Shift(iv, z, out, blocks);
+  return 0;
+}
+
+int kuz_cbc_decrypt(const kuz_ctx_t* ctx, uint8_t* iv, size_t ivlen, const uint8_t* in, uint8_t* out, size_t blocks)
+{
+  uint8_t d[KUZ_CTR_BATCH*KUZ_BLOCK_SIZE];
+  uint8_t next[MAX_REG];
+  size_t z = RegisterBlocks(ivlen);
+  size_t n, j, used = 0;
+
+  if(z == 0)
+  {
+    return -1;
+  }
+  for(; blocks > 0; blocks -= n)
+  {
+    n = blocks < KUZ_CTR_BATCH ? blocks : KUZ_CTR_BATCH;
+    kuz_decrypt_blocks(ctx, in, d, n);
+
+    // The register of the next batch, before in is overwritten
+    memcpy(next, iv, ivlen);
+    Shift(next, z, in, n);
+
+    for(j=n;j-->0;)
+    {
+      Xor(out + j*KUZ_BLOCK_SIZE, d + j*KUZ_BLOCK_SIZE,
+          j >= z ? in + (j - z)*KUZ_BLOCK_SIZE : iv + j*KUZ_BLOCK_SIZE, KUZ_BLOCK_SIZE);
+    }
+    memcpy(iv, next, ivlen);
+    in += n*KUZ_BLOCK_SIZE;
+    out += n*KUZ_BLOCK_SIZE;
+    used = n > used ? n : used;
+  }
+  kuz_wipe(d, used*KUZ_BLOCK_SIZE);
+  return 0;
+}
+
+/*****************************************************************************/
+/* CFB                                                                       */
+/*****************************************************************************/
+
+int kuz_cfb_encrypt(const kuz_ctx_t* ctx, uint8_t* iv, size_t ivlen, const uint8_t* in, uint8_t* out, size_t len)
+{
+  uint8_t ks[MAX_REG];
+  size_t z = RegisterBlocks(ivlen);
+  size_t blocks = len / KUZ_BLOCK_SIZE;
+  size_t i, n;
+
+  if(z == 0)
+  {
+    return -1;
+  }
+  for(i=0;i<blocks;i+=n)
+  {
+    n = blocks - i < z ? blocks - i : z;
+    kuz_encrypt_blocks(ctx, i == 0 ? iv : out + (i - z)*KUZ_BLOCK_SIZE, ks, n);
+    Xor(out + i*KUZ_BLOCK_SIZE, in + i*KUZ_BLOCK_SIZE, ks, n*KUZ_BLOCK_SIZE);
+  }
+  Shift(iv, z, out, blocks);
+
+  // Truncated last block : the message ends here
+  if(len % KUZ_BLOCK_SIZE != 0)
+  {
+    kuz_encrypt(ctx, iv, ks);
+    Xor(out + blocks*KUZ_BLOCK_SIZE, in + blocks*KUZ_BLOCK_SIZE, ks, len % KUZ_BLOCK_SIZE);
+  }
+  kuz_wipe(ks, sizeof(ks));
+  return 0;
+}
+
+int kuz_cfb_decrypt(const kuz_ctx_t* ctx, uint8_t* iv, size_t ivlen, const uint8_t* in, uint8_t* out, size_t len)
+{
+  uint8_t ks[KUZ_CTR_BATCH*KUZ_BLOCK_SIZE + MAX_REG];
+  size_t z = RegisterBlocks(ivlen);
+  size_t n, r, bytes, used = 0;
+
+  if(z == 0)
+  {
+    return -1;
+  }
+  while(len > 0)
+  {
+    // z blocks from the register plus a full batch from in
+    n = (len + KUZ_BLOCK_SIZE - 1) / KUZ_BLOCK_SIZE;
+    n = n < KUZ_CTR_BATCH + z ? n : KUZ_CTR_BATCH + z;
+    bytes = n*KUZ_BLOCK_SIZE < len ? n*KUZ_BLOCK_SIZE : len;
+
+    // E(C(i-z)) of the whole batch : the register, then the batch itself
+    r = n < z ? n : z;
+    kuz_encrypt_blocks(ctx, iv, ks, r);
+    kuz_encrypt_blocks(ctx, in, ks + r*KUZ_BLOCK_SIZE, n - r);
+    Shift(iv, z, in, bytes / KUZ_BLOCK_SIZE);
+
+    Xor(out, in, ks, bytes);
+    in += bytes;
+    out += bytes;
+    len -= bytes;
+    used = n > used ? n : used;
+  }
+  kuz_wipe(ks, used*KUZ_BLOCK_SIZE);
+  return 0;
+}
+
+/*****************************************************************************/
+/* OFB                                                                       */
+/*****************************************************************************/
+
+int kuz_ofb_xor(const kuz_ctx_t* ctx, uint8_t* iv, size_t ivlen, const uint8_t* in, uint8_t* out, size_t len)
+{
+  uint8_t ks[MAX_REG];
+  size_t z = RegisterBlocks(ivlen);
+  size_t n, bytes;
+
+  if(z == 0)
+  {
+    return -1;
+  }
+  while(len > 0)
+  {
+    n = (len + KUZ_BLOCK_SIZE - 1) / KUZ_BLOCK_SIZE;
+    n = n < z ? n : z;
+    bytes = n*KUZ_BLOCK_SIZE < len ? n*KUZ_BLOCK_SIZE : len;
+
+    kuz_encrypt_blocks(ctx, iv, ks, n);
+    Shift(iv, z, ks, n);
+    Xor(out, in, ks, bytes);
+    in += bytes;
+    out += bytes;
+    len -= bytes;
+  }
+  kuz_wipe(ks, sizeof(ks));
+  return 0;
+}
@@ -0,0 +1,61 @@
+/* Private declarations shared by kuznyechik.c and its host backends. */
+
+#ifndef _KUZNYECHIK_INTERNAL_H_
+#define _KUZNYECHIK_INTERNAL_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "kuznyechik.h"
+
+// Cipher constants of kuznyechik.c
+extern uint8_t sbox[256];
+extern uint8_t rsbox[256];
+
+// L and L^-1 steps of the reference code, on one 16-byte state.
+void kuz_lstep(uint8_t* state);
+void kuz_inv_lstep(uint8_t* state);
+
+#ifdef KUZNYECHIK_LS_TABLES
+
+// One 128-bit table entry, addressable as bytes or as two 64-bit words.
+typedef union
+{
+  uint8_t  b[16];
+  uint64_t q[2];
+} lsblock_t;
+
+// LS_enc[i][v] = L(S(v) placed at byte i of an all-zero state).
+// ILS_dec[i][v] = L^-1(S^-1(v) placed at byte i of an all-zero state).
+// Both are generated by gen_tables.c (kuznyechik_ls_tables.h), read-only.
+extern const lsblock_t LS_enc[16][256];
+extern const lsblock_t ILS_dec[16][256];
+
+#endif // KUZNYECHIK_LS_TABLES
+
+#ifdef KUZNYECHIK_SIMD
+
+// x86-64 kernels (kuznyechik_x86.c). They process whole groups of blocks
+// and return how many they handled, 0 if the CPU lacks SSE4.1 : the caller
+// finishes the tail with the portable code.
+// kuz_x86_init() picks the kernel and builds its constants, run once
+// (pthread_once) by kuznyechik.c. KUZ_X86_KERNEL=avx2|sse4.1|c in the
+// environment forces a narrower kernel than the CPU's, for the tests. kuz_x86_key_expansion() fills rk and rkd, or returns 0
+// when the selected kernel has no key schedule of its own.
+void kuz_x86_init(void);
+int kuz_x86_key_expansion(kuz_ctx_t* ctx, const uint8_t* key, const uint8_t (*c)[KUZ_BLOCK_SIZE]);
+size_t kuz_x86_encrypt_blocks(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out, size_t blocks);
+size_t kuz_x86_decrypt_blocks(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out, size_t blocks);
+const char* kuz_x86_engine(void);
+
+#endif // KUZNYECHIK_SIMD
+
+#ifdef KUZNYECHIK_BITSLICE
+
+// Key schedule of the bitsliced engine (kuznyechik_bitslice.c) with the
+// constants c of kuznyechik.c, for kuz_ctx_init() under
+// KUZNYECHIK_BITSLICE_ENGINE. kuz_bs_ctx_init() passes its own copy.
+void kuz_bs_key_expansion(kuz_ctx_t* ctx, const uint8_t* key, const uint8_t (*c)[KUZ_BLOCK_SIZE]);
+
+#endif // KUZNYECHIK_BITSLICE
+
+#endif //_KUZNYECHIK_INTERNAL_H_
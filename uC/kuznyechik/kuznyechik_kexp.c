@@ -0,0 +1,169 @@
+/* KExp15 / KImp15 key export and import (R 1323565.1.017-2018) for Kuznyechik. */
+
+/*
+
+A key K is wrapped under two keys, one for the MAC and one for encryption,
+with an IV of half a block :
+
+  KExp15(K) = CTR_Kenc(IV, K || OMAC_Kmac(IV || K))     48 bytes
+  KImp15    : CTR decryption, then the MAC is checked
+
+kuz_kimp15() unwraps one key with its 3 keystream blocks and a streaming
+MAC, so it fits the small targets. kuz_kimp15_batch() unwraps KUZ_CTR_BATCH
+keys per pass : the 3 keystream blocks of every key in one
+kuz_encrypt_blocks() call, then the MACs of the 40-byte IV || K messages
+side by side with kuz_omac_batch().
+
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include "kuznyechik.h"
+#include "kuznyechik_modes.h"
+
+#define MAC_INPUT (KUZ_KEXP_IV_SIZE + KUZ_KEY_SIZE)
+#define WRAP_BLOCKS (KUZ_KEXP_SIZE / KUZ_BLOCK_SIZE)
+
+// Counters IV || 0, 1, 2 of one key
+static void Counters(uint8_t* ks, const uint8_t* iv)
+{
+  size_t b;
+
+  memset(ks, 0, KUZ_KEXP_SIZE);
+  for(b=0;b<WRAP_BLOCKS;b++)
+  {
+    memcpy(ks + b*KUZ_BLOCK_SIZE, iv, KUZ_KEXP_IV_SIZE);
+    ks[(b + 1)*KUZ_BLOCK_SIZE - 1] = (uint8_t)b;
+  }
+}
+
+// Constant-time compare of two MACs : 0 if they match
+static uint8_t TagDiff(const uint8_t* a, const uint8_t* b)
+{
+  uint8_t diff = 0;
+  size_t i;
+
+  for(i=0;i<KUZ_BLOCK_SIZE;i++)
+  {
+    diff |= a[i] ^ b[i];
+  }
+  return diff;
+}
+
+void kuz_kexp15(const kuz_omac_key_t* mac, const kuz_ctx_t* enc, const uint8_t* iv, const uint8_t* key, uint8_t* wrapped)
+{
+  uint8_t ks[KUZ_KEXP_SIZE];
+  kuz_omac_t st;
+  size_t i;
+
+  kuz_omac_init(&st, mac);
+  kuz_omac_update(&st, iv, KUZ_KEXP_IV_SIZE);
+  kuz_omac_update(&st, key, KUZ_KEY_SIZE);
+  kuz_omac_final(&st, wrapped + KUZ_KEY_SIZE, KUZ_BLOCK_SIZE);
+  memcpy(wrapped, key, KUZ_KEY_SIZE);
+
+  Counters(ks, iv);
+  kuz_encrypt_blocks(enc, ks, ks, WRAP_BLOCKS);
+  for(i=0;i<KUZ_KEXP_SIZE;i++)
+  {
+    wrapped[i] ^= ks[i];
+  }
+  kuz_wipe(ks, sizeof(ks));
+}
+
+int kuz_kimp15(const kuz_omac_key_t* mac, const kuz_ctx_t* enc, const uint8_t* iv, const uint8_t* wrapped, uint8_t* key)
+{
+  uint8_t ks[KUZ_KEXP_SIZE];
+  uint8_t tag[KUZ_BLOCK_SIZE];
+  kuz_omac_t st;
+  size_t i;
+  int ret = 0;
+
+  // K || MAC in place of the keystream
+  Counters(ks, iv);
+  kuz_encrypt_blocks(enc, ks, ks, WRAP_BLOCKS);
+  for(i=0;i<KUZ_KEXP_SIZE;i++)
+  {
+    ks[i] ^= wrapped[i];
+  }
+
+  kuz_omac_init(&st, mac);
+  kuz_omac_update(&st, iv, KUZ_KEXP_IV_SIZE);
+  kuz_omac_update(&st, ks, KUZ_KEY_SIZE);
+  kuz_omac_final(&st, tag, KUZ_BLOCK_SIZE);
+
+  if(TagDiff(tag, ks + KUZ_KEY_SIZE) == 0)
+  {
+    memcpy(key, ks, KUZ_KEY_SIZE);
+  }
+  else
+  {
+    memset(key, 0, KUZ_KEY_SIZE);
+    ret = -1;
+  }
+  kuz_wipe(ks, sizeof(ks));
+  return ret;
+}
+
+size_t kuz_kimp15_batch(const kuz_omac_key_t* mac, const kuz_ctx_t* enc, const uint8_t* ivs,
+                        const uint8_t* wrapped, uint8_t* keys, size_t count)
+{
+  uint8_t ks[KUZ_CTR_BATCH*KUZ_KEXP_SIZE];
+  uint8_t msg[KUZ_CTR_BATCH][MAC_INPUT];
+  uint8_t tags[KUZ_CTR_BATCH*KUZ_BLOCK_SIZE];
+  const uint8_t* msgs[KUZ_CTR_BATCH];
+  size_t lens[KUZ_CTR_BATCH];
+  size_t failed = 0;
+  size_t group, k;
+
+  for(k=0;k<KUZ_CTR_BATCH;k++)
+  {
+    msgs[k] = msg[k];
+    lens[k] = MAC_INPUT;
+  }
+
+  for(; count > 0; count -= group)
+  {
+    group = count < KUZ_CTR_BATCH ? count : KUZ_CTR_BATCH;
+
+    // Counters IV || 0, 1, 2 of every key, encrypted together
+    for(k=0;k<group;k++)
+    {
+      Counters(ks + k*KUZ_KEXP_SIZE, ivs + k*KUZ_KEXP_IV_SIZE);
+    }
+    kuz_encrypt_blocks(enc, ks, ks, group*WRAP_BLOCKS);
+
+    // K || MAC in place of the keystream
+    for(k=0;k<group*KUZ_KEXP_SIZE;k++)
+    {
+      ks[k] ^= wrapped[k];
+    }
+    for(k=0;k<group;k++)
+    {
+      memcpy(msg[k], ivs + k*KUZ_KEXP_IV_SIZE, KUZ_KEXP_IV_SIZE);
+      memcpy(msg[k] + KUZ_KEXP_IV_SIZE, ks + k*KUZ_KEXP_SIZE, KUZ_KEY_SIZE);
+    }
+    kuz_omac_batch(mac, msgs, lens, tags, KUZ_BLOCK_SIZE, group);
+
+    // Constant-time compare; a key whose MAC fails is zeroed
+    for(k=0;k<group;k++)
+    {
+      if(TagDiff(tags + k*KUZ_BLOCK_SIZE, ks + k*KUZ_KEXP_SIZE + KUZ_KEY_SIZE) == 0)
+      {
+        memcpy(keys + k*KUZ_KEY_SIZE, ks + k*KUZ_KEXP_SIZE, KUZ_KEY_SIZE);
+      }
+      else
+      {
+        memset(keys + k*KUZ_KEY_SIZE, 0, KUZ_KEY_SIZE);
+        failed++;
+      }
+    }
+
+    ivs += group*KUZ_KEXP_IV_SIZE;
+    wrapped += group*KUZ_KEXP_SIZE;
+    keys += group*KUZ_KEY_SIZE;
+  }
+  kuz_wipe(ks, sizeof(ks));
+  kuz_wipe(msg, sizeof(msg));
+  return failed;
+}
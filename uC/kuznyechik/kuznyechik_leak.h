@@ -0,0 +1,41 @@
+/* Leakage hooks of kuznyechik.c and kuznyechik_masked.c, for the host simulator. */
+
+#ifndef _KUZNYECHIK_LEAK_H_
+#define _KUZNYECHIK_LEAK_H_
+
+#include <stdint.h>
+
+// KUZ_LEAK_STORE(dst, v) is the store dst = v of one state byte of the
+// cipher (AddRoundKey, S step, R step). It is a plain store unless
+// KUZNYECHIK_LEAKAGE is defined : then kuz_leak() sees the byte before and
+// after every store (kuznyechik_leakage/ turns them into power samples).
+//
+// KUZ_PRIVATE_VAR is the storage of the private state of the masked code :
+// thread-local in the simulator, so that its workers encrypt side by side.
+//
+// KUZ_RAND() / KUZ_SRAND(s) draw the masks of kuznyechik_masked.c : rand()
+// and srand() of <stdlib.h>, or one generator per thread in the simulator.
+
+#ifdef KUZNYECHIK_LEAKAGE
+
+void kuz_leak(uint8_t before, uint8_t after);
+
+#define KUZ_LEAK_STORE(dst, v) do { uint8_t leak_ = (v); kuz_leak((dst), leak_); (dst) = leak_; } while(0)
+#define KUZ_PRIVATE_VAR static __thread
+
+// The glibc generator, so the masks are the same as a single thread's
+int kuz_leak_rand(void);
+void kuz_leak_srand(unsigned int seed);
+#define KUZ_RAND() kuz_leak_rand()
+#define KUZ_SRAND(s) kuz_leak_srand(s)
+
+#else
+
+#define KUZ_LEAK_STORE(dst, v) ((dst) = (v))
+#define KUZ_PRIVATE_VAR static
+#define KUZ_RAND() rand()
+#define KUZ_SRAND(s) srand(s)
+
+#endif // KUZNYECHIK_LEAKAGE
+
+#endif //_KUZNYECHIK_LEAK_H_
@@ -0,0 +1,428 @@
+/* MGM authenticated encryption (R 1323565.1.026-2019) for Kuznyechik. */
+
+/*
+
+With a 128-bit nonce ICN whose first bit is 0 :
+
+  Y1 = E(0||ICN), Y(i+1) = Yi + 1 on the right 64 bits   C = P ^ E(Y1), E(Y2)...
+  Z1 = E(1||ICN), Z(i+1) = Zi + 1 on the left 64 bits    Hi = E(Zi)
+  T = E( H1.A1 ^ ... ^ Hh.Ah ^ H(h+1).C1 ^ ... ^ H(h+q+1).(len(A)||len(C)) )
+
+The last blocks of A and C are padded with zeroes, lengths are in bits.
+Products are in GF(2^128) = GF(2)[x] / (x^128 + x^7 + x^2 + x + 1), block
+byte 0 holding the highest coefficients (no bit reflection as in GCM).
+
+Every Hi is different, so there is no multiplier to precompute tables for :
+
+  PCLMULQDQ (x86-64, picked from CPUID by kuz_mgm_init and kept in the
+    state) : the products of a whole batch are summed unreduced, one
+    reduction per batch.
+  otherwise : a 16-entry table of multiples of Hi per block, then 32 steps
+    of 4 bits with a 16-entry reduction table.
+
+The counters of a batch (KUZ_CTR_BATCH blocks of keystream and as many Hi)
+are encrypted with one kuz_encrypt_blocks() call.
+
+Test vector (R 1323565.1.026-2019, A.1), with the key of kuznyechik.c :
+
+  Nonce : 1122334455667700ffeeddccbbaa9988
+  A     : 0202020202020202010101010101010104040404040404040303030303030303
+          ea05050505050505 05
+  P     : 1122334455667700ffeeddccbbaa998800112233445566778899aabbcceeff0a
+          112233445566778899aabbcceeff0a002233445566778899aabbcceeff0a0011
+          aabbcc
+  C     : a9757b8147956e9055b8a33de89f42fc8075d2212bf9fd5bd3f7069aadc16b39
+          497ab15915a6ba85936b5d0ea9f6851cc60c14d4d3f883d0ab94420695c76deb
+          2c7552
+  T     : cf5d656f40c34f5c46e8bb0e29fcdb4c
+
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include "kuznyechik.h"
+#include "kuznyechik_modes.h"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define MGM_PCLMUL
+#define PCLMUL __attribute__((target("pclmul,ssse3")))
+#endif
+
+/*****************************************************************************/
+/* GF(2^128) multiply-accumulate                                             */
+/*****************************************************************************/
+
+// A field element is held as x[1] = coefficients 127..64, x[0] = 63..0.
+
+static uint64_t LoadBE64(const uint8_t* p)
+{
+  uint64_t v = 0;
+  uint8_t i;
+  for(i=0;i<8;i++)
+  {
+    v = (v << 8) | p[i];
+  }
+  return v;
+}
+
+static void StoreBE64(uint8_t* p, uint64_t v)
+{
+  int8_t i;
+  for(i=7;i>=0;i--)
+  {
+    p[i] = (uint8_t)v;
+    v >>= 8;
+  }
+}
+
+// R[v] = v.x^128 mod the field polynomial, for the 4 bits shifted out
+static const uint16_t R[16] = {
+  0x0000, 0x0087, 0x010e, 0x0189, 0x021c, 0x029b, 0x0312, 0x0395,
+  0x0438, 0x04bf, 0x0536, 0x05b1, 0x0624, 0x06a3, 0x072a, 0x07ad };
+
+static void MulAccTable(uint64_t* sum, const uint8_t* h, const uint8_t* x, size_t n)
+{
+  uint64_t m[16][2];
+  uint64_t z1, z0, x1, x0, top;
+  uint8_t i, j, nib;
+
+  for(; n > 0; n--, h += KUZ_BLOCK_SIZE, x += KUZ_BLOCK_SIZE)
+  {
+    // m[v] = v.H for the 16 polynomials v of degree < 4
+    m[0][1] = 0;
+    m[0][0] = 0;
+    m[1][1] = LoadBE64(h);
+    m[1][0] = LoadBE64(h + 8);
+    for(i=2;i<16;i<<=1)
+    {
+      top = m[i >> 1][1] >> 63;
+      m[i][1] = (m[i >> 1][1] << 1) | (m[i >> 1][0] >> 63);
+      m[i][0] = (m[i >> 1][0] << 1) ^ (0x87 & (0 - top));
+      for(j=1;j<i;j++)
+      {
+        m[i + j][1] = m[i][1] ^ m[j][1];
+        m[i + j][0] = m[i][0] ^ m[j][0];
+      }
+    }
+
+    // Horner on the 32 nibbles of X, highest first
+    x1 = LoadBE64(x);
+    x0 = LoadBE64(x + 8);
+    z1 = 0;
+    z0 = 0;
+    for(i=0;i<32;i++)
+    {
+      top = z1 >> 60;
+      z1 = (z1 << 4) | (z0 >> 60);
+      z0 = (z0 << 4) ^ R[top];
+      nib = (uint8_t)(x1 >> 60);
+      x1 = (x1 << 4) | (x0 >> 60);
+      x0 <<= 4;
+      z1 ^= m[nib][1];
+      z0 ^= m[nib][0];
+    }
+    sum[1] ^= z1;
+    sum[0] ^= z0;
+  }
+}
+
+#ifdef MGM_PCLMUL
+
+static PCLMUL void MulAccPclmul(uint64_t* sum, const uint8_t* h, const uint8_t* x, size_t n)
+{
+  const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  const __m128i poly = _mm_set_epi64x(0, 0x87);
+  __m128i lo = _mm_setzero_si128();
+  __m128i mid = _mm_setzero_si128();
+  __m128i hi = _mm_setzero_si128();
+  __m128i a, b, t;
+
+  for(; n > 0; n--, h += KUZ_BLOCK_SIZE, x += KUZ_BLOCK_SIZE)
+  {
+    a = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)h), bswap);
+    b = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)x), bswap);
+    lo  = _mm_xor_si128(lo,  _mm_clmulepi64_si128(a, b, 0x00));
+    hi  = _mm_xor_si128(hi,  _mm_clmulepi64_si128(a, b, 0x11));
+    mid = _mm_xor_si128(mid, _mm_clmulepi64_si128(a, b, 0x01));
+    mid = _mm_xor_si128(mid, _mm_clmulepi64_si128(a, b, 0x10));
+  }
+  lo = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+  hi = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+  // hi:lo is 256 bits. x^192 terms : hi[1].0x87 lands at x^64,
+  // then the x^128 terms (hi[0] with that carry) : hi[0].0x87 at x^0.
+  t = _mm_clmulepi64_si128(hi, poly, 0x01);
+  lo = _mm_xor_si128(lo, _mm_slli_si128(t, 8));
+  hi = _mm_xor_si128(hi, _mm_srli_si128(t, 8));
+  lo = _mm_xor_si128(lo, _mm_clmulepi64_si128(hi, poly, 0x00));
+
+  _mm_storeu_si128((__m128i*)sum, _mm_xor_si128(_mm_loadu_si128((const __m128i*)sum), lo));
+}
+
+#endif // MGM_PCLMUL
+
+// st->sum ^= h[0].x[0] ^ ... ^ h[n-1].x[n-1], with the multiplier picked
+// by kuz_mgm_init()
+static void MulAcc(kuz_mgm_t* st, const uint8_t* h, const uint8_t* x, size_t n)
+{
+#ifdef MGM_PCLMUL
+  if(st->pclmul)
+  {
+    MulAccPclmul(st->sum, h, x, n);
+    return;
+  }
+#endif
+  MulAccTable(st->sum, h, x, n);
+}
+
+/*****************************************************************************/
+/* Counters                                                                  */
+/*****************************************************************************/
+
+// Big-endian increment of 8 bytes, mod 2^64
+static void Increment64(uint8_t* half)
+{
+  int8_t i;
+  for(i=7;i>=0;i--)
+  {
+    if(++half[i] != 0)
+    {
+      break;
+    }
+  }
+}
+
+// Next n values of Z (left half counter) : the multipliers H
+static void NextH(kuz_mgm_t* st, uint8_t* blocks, size_t n)
+{
+  size_t i;
+  for(i=0;i<n;i++)
+  {
+    memcpy(blocks + i*KUZ_BLOCK_SIZE, st->z, KUZ_BLOCK_SIZE);
+    Increment64(st->z);
+  }
+}
+
+// Next n values of Y (right half counter) : the keystream
+static void NextY(kuz_mgm_t* st, uint8_t* blocks, size_t n)
+{
+  size_t i;
+  for(i=0;i<n;i++)
+  {
+    memcpy(blocks + i*KUZ_BLOCK_SIZE, st->y, KUZ_BLOCK_SIZE);
+    Increment64(st->y + KUZ_BLOCK_SIZE/2);
+  }
+}
+
+// Authenticate n whole blocks of A or C
+static void AuthBlocks(kuz_mgm_t* st, const uint8_t* x, size_t n)
+{
+  uint8_t h[KUZ_CTR_BATCH*KUZ_BLOCK_SIZE];
+  size_t group, used = 0;
+
+  for(; n > 0; n -= group, x += group*KUZ_BLOCK_SIZE)
+  {
+    group = n < KUZ_CTR_BATCH ? n : KUZ_CTR_BATCH;
+    used = group > used ? group : used;
+    NextH(st, h, group);
+    kuz_encrypt_blocks(st->ctx, h, h, group);
+    MulAcc(st, h, x, group);
+  }
+  kuz_wipe(h, used*KUZ_BLOCK_SIZE);
+}
+
+// Authenticate the pending partial block, zero padded
+static void AuthFlush(kuz_mgm_t* st)
+{
+  if(st->buflen != 0)
+  {
+    memset(st->buf + st->buflen, 0, KUZ_BLOCK_SIZE - st->buflen);
+    AuthBlocks(st, st->buf, 1);
+    st->buflen = 0;
+  }
+}
+
+/*****************************************************************************/
+/* Public functions:                                                         */
+/*****************************************************************************/
+
+void kuz_mgm_init(kuz_mgm_t* st, const kuz_ctx_t* ctx, const uint8_t* nonce)
+{
+  uint8_t yz[2*KUZ_BLOCK_SIZE];
+
+  memset(st, 0, sizeof(kuz_mgm_t));
+  st->ctx = ctx;
+#ifdef MGM_PCLMUL
+  // Read-only : libgcc fills the CPU model before main, so concurrent
+  // initialisations share no state
+  st->pclmul = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3");
+#endif
+
+  memcpy(yz, nonce, KUZ_BLOCK_SIZE);
+  memcpy(yz + KUZ_BLOCK_SIZE, nonce, KUZ_BLOCK_SIZE);
+  yz[0] &= 0x7f;
+  yz[KUZ_BLOCK_SIZE] |= 0x80;
+  kuz_encrypt_blocks(ctx, yz, yz, 2);
+  memcpy(st->y, yz, KUZ_BLOCK_SIZE);
+  memcpy(st->z, yz + KUZ_BLOCK_SIZE, KUZ_BLOCK_SIZE);
+  kuz_wipe(yz, sizeof(yz));
+}
+
+int kuz_mgm_aad(kuz_mgm_t* st, const uint8_t* aad, size_t len)
+{
+  size_t n;
+
+  if(st->data)
+  {
+    return -1;
+  }
+  st->alen += len;
+
+  if(st->buflen != 0)
+  {
+    n = (size_t)(KUZ_BLOCK_SIZE - st->buflen) < len ? (size_t)(KUZ_BLOCK_SIZE - st->buflen) : len;
+    memcpy(st->buf + st->buflen, aad, n);
+    st->buflen += n;
+    aad += n;
+    len -= n;
+    if(st->buflen < KUZ_BLOCK_SIZE)
+    {
+      return 0;
+    }
+    AuthBlocks(st, st->buf, 1);
+    st->buflen = 0;
+  }
+
+  n = len / KUZ_BLOCK_SIZE;
+  AuthBlocks(st, aad, n);
+  aad += n*KUZ_BLOCK_SIZE;
+  len -= n*KUZ_BLOCK_SIZE;
+
+  memcpy(st->buf, aad, len);
+  st->buflen = (uint8_t)len;
+  return 0;
+}
+
+// Encryption and decryption only differ in which side of the XOR is C.
+// The keystream of a partial block is kept in ks, C itself in buf.
+static void Crypt(kuz_mgm_t* st, const uint8_t* in, uint8_t* out, size_t len, uint8_t decrypt)
+{
+  uint8_t blocks[2*KUZ_CTR_BATCH*KUZ_BLOCK_SIZE];
+  uint8_t* h;
+  uint8_t c;
+  size_t n, i, used = 0;
+
+  if(!st->data)
+  {
+    AuthFlush(st);
+    st->data = 1;
+  }
+  st->clen += len;
+
+  // Finish the partial block of the previous call
+  for(; st->buflen != 0 && st->buflen < KUZ_BLOCK_SIZE && len > 0; len--)
+  {
+    c = *in ^ st->ks[st->buflen];
+    st->buf[st->buflen++] = decrypt ? *in : c;
+    *out = c;
+    in++;
+    out++;
+  }
+  if(st->buflen == KUZ_BLOCK_SIZE)
+  {
+    AuthBlocks(st, st->buf, 1);
+    st->buflen = 0;
+  }
+
+  // Whole blocks : keystream and H of a batch in one call
+  while(len >= KUZ_BLOCK_SIZE)
+  {
+    n = len / KUZ_BLOCK_SIZE;
+    if(n > KUZ_CTR_BATCH)
+    {
+      n = KUZ_CTR_BATCH;
+    }
+    used = n > used ? n : used;
+    h = blocks + n*KUZ_BLOCK_SIZE;
+    NextY(st, blocks, n);
+    NextH(st, h, n);
+    kuz_encrypt_blocks(st->ctx, blocks, blocks, 2*n);
+
+    if(decrypt)
+    {
+      MulAcc(st, h, in, n);
+    }
+    for(i=0;i<n*KUZ_BLOCK_SIZE;i++)
+    {
+      out[i] = in[i] ^ blocks[i];
+    }
+    if(!decrypt)
+    {
+      MulAcc(st, h, out, n);
+    }
+    in += n*KUZ_BLOCK_SIZE;
+    out += n*KUZ_BLOCK_SIZE;
+    len -= n*KUZ_BLOCK_SIZE;
+  }
+
+  // Start a partial block
+  if(len > 0)
+  {
+    NextY(st, st->ks, 1);
+    kuz_encrypt(st->ctx, st->ks, st->ks);
+    for(i=0;i<len;i++)
+    {
+      c = in[i] ^ st->ks[i];
+      st->buf[i] = decrypt ? in[i] : c;
+      out[i] = c;
+    }
+    st->buflen = (uint8_t)len;
+  }
+  kuz_wipe(blocks, 2*used*KUZ_BLOCK_SIZE);
+}
+
+void kuz_mgm_encrypt(kuz_mgm_t* st, const uint8_t* in, uint8_t* out, size_t len)
+{
+  Crypt(st, in, out, len, 0);
+}
+
+void kuz_mgm_decrypt(kuz_mgm_t* st, const uint8_t* in, uint8_t* out, size_t len)
+{
+  Crypt(st, in, out, len, 1);
+}
+
+void kuz_mgm_final(kuz_mgm_t* st, uint8_t* tag, size_t taglen)
+{
+  uint8_t lengths[KUZ_BLOCK_SIZE];
+  uint8_t t[KUZ_BLOCK_SIZE];
+
+  AuthFlush(st);
+  StoreBE64(lengths, st->alen*8);
+  StoreBE64(lengths + 8, st->clen*8);
+  AuthBlocks(st, lengths, 1);
+
+  StoreBE64(t, st->sum[1]);
+  StoreBE64(t + 8, st->sum[0]);
+  kuz_encrypt(st->ctx, t, t);
+  memcpy(tag, t, taglen < KUZ_BLOCK_SIZE ? taglen : KUZ_BLOCK_SIZE);
+  kuz_wipe(st, sizeof(kuz_mgm_t));
+}
+
+int kuz_mgm_verify(kuz_mgm_t* st, const uint8_t* tag, size_t taglen)
+{
+  uint8_t t[KUZ_BLOCK_SIZE];
+  uint8_t diff = 0;
+  size_t i;
+
+  if(taglen == 0 || taglen > KUZ_BLOCK_SIZE)
+  {
+    return -1;
+  }
+  kuz_mgm_final(st, t, taglen);
+  for(i=0;i<taglen;i++)
+  {
+    diff |= t[i] ^ tag[i];
+  }
+  return diff == 0 ? 0 : -1;
+}
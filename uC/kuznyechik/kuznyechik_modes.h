@@ -0,0 +1,193 @@
+/* Modes of operation of GOST R 34.13-2015 on top of the Kuznyechik contexts. */
+
+#ifndef _KUZNYECHIK_MODES_H_
+#define _KUZNYECHIK_MODES_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "kuznyechik.h"
+
+// Half-block initial value of the CTR mode
+#define KUZ_CTR_IV_SIZE (KUZ_BLOCK_SIZE/2)
+
+// Keystream blocks computed per kuz_encrypt_blocks() call, so the SIMD and
+// table engines always get full groups. It also sizes the stack buffers of
+// the batched calls (about 3.8KB for kuz_kimp15_batch) : small targets can
+// lower it, e.g. -DKUZ_CTR_BATCH=4.
+#ifndef KUZ_CTR_BATCH
+#define KUZ_CTR_BATCH 32
+#endif
+
+/*****************************************************************************/
+/* CTR (kuznyechik_ctr.c)                                                    */
+/*****************************************************************************/
+
+// out = in ^ E(IV || 0^64), E(IV || 0^64 + 1), ... The counter is the whole
+// block, big-endian, incremented mod 2^128. len may be any number of bytes,
+// the last keystream block is truncated. in and out may be the same buffer.
+void kuz_ctr_xor(const kuz_ctx_t* ctx, const uint8_t* iv, const uint8_t* in, uint8_t* out, size_t len);
+
+// Same keystream, starting at block number first of the stream (random
+// access, or one slice of a buffer shared between threads).
+void kuz_ctr_xor_from(const kuz_ctx_t* ctx, const uint8_t* iv, uint64_t first, const uint8_t* in, uint8_t* out, size_t len);
+
+// CTR-ACPKM : CTR whose key is meshed every section bytes (a multiple of
+// the block size), for long streams. The state holds its own copy of the
+// current key : erase it with kuz_acpkm_wipe() when done.
+typedef struct
+{
+  kuz_ctx_t ctx;                 // key of the current section
+  uint8_t   ctr[KUZ_BLOCK_SIZE];
+  uint8_t   ks[KUZ_BLOCK_SIZE];  // keystream of a partial block
+  size_t    section;
+  size_t    used;                // bytes of the current section consumed
+  uint8_t   kslen;               // bytes of ks not used yet
+} kuz_acpkm_t;
+
+// -1 if section is not a positive multiple of KUZ_BLOCK_SIZE
+int kuz_acpkm_init(kuz_acpkm_t* st, const kuz_ctx_t* ctx, const uint8_t* iv, size_t section);
+
+// Stream in as many calls of any length as needed. in and out may be the
+// same buffer.
+void kuz_acpkm_xor(kuz_acpkm_t* st, const uint8_t* in, uint8_t* out, size_t len);
+
+// Erase the section key, counter and keystream of st.
+void kuz_acpkm_wipe(kuz_acpkm_t* st);
+
+/*****************************************************************************/
+/* CBC, CFB, OFB (kuznyechik_feedback.c)                                     */
+/*****************************************************************************/
+
+// The IV is the register R of the standard : ivlen = z*16 bytes, z = 1 to
+// KUZ_IV_MAX_BLOCKS, block i being chained to block i-z. Each call updates
+// iv in place, so a message may be split over several calls; CFB and OFB
+// accept a truncated last block, which ends the message. in and out may be
+// the same buffer. All return -1 for an unsupported ivlen, 0 otherwise.
+#define KUZ_IV_MAX_BLOCKS 4
+
+int kuz_cbc_encrypt(const kuz_ctx_t* ctx, uint8_t* iv, size_t ivlen, const uint8_t* in, uint8_t* out, size_t blocks);
+int kuz_cbc_decrypt(const kuz_ctx_t* ctx, uint8_t* iv, size_t ivlen, const uint8_t* in, uint8_t* out, size_t blocks);
+int kuz_cfb_encrypt(const kuz_ctx_t* ctx, uint8_t* iv, size_t ivlen, const uint8_t* in, uint8_t* out, size_t len);
+int kuz_cfb_decrypt(const kuz_ctx_t* ctx, uint8_t* iv, size_t ivlen, const uint8_t* in, uint8_t* out, size_t len);
+
+// OFB : encryption and decryption are the same operation
+int kuz_ofb_xor(const kuz_ctx_t* ctx, uint8_t* iv, size_t ivlen, const uint8_t* in, uint8_t* out, size_t len);
+
+/*****************************************************************************/
+/* MAC, OMAC1 (kuznyechik_omac.c)                                            */
+/*****************************************************************************/
+
+// Subkeys K1, K2 of a key, derived once by kuz_omac_key_init(). It points to
+// ctx, which must outlive it.
+typedef struct
+{
+  const kuz_ctx_t* ctx;
+  uint8_t k1[KUZ_BLOCK_SIZE];
+  uint8_t k2[KUZ_BLOCK_SIZE];
+} kuz_omac_key_t;
+
+// State of one message
+typedef struct
+{
+  const kuz_omac_key_t* key;
+  uint8_t acc[KUZ_BLOCK_SIZE];
+  uint8_t buf[KUZ_BLOCK_SIZE];  // last block seen, 0..16 bytes
+  uint8_t buflen;
+} kuz_omac_t;
+
+void kuz_omac_key_init(kuz_omac_key_t* key, const kuz_ctx_t* ctx);
+
+// Data in as many calls of any length as needed, then the first maclen
+// (1..16) bytes of the MAC. final wipes the state.
+void kuz_omac_init(kuz_omac_t* st, const kuz_omac_key_t* key);
+void kuz_omac_update(kuz_omac_t* st, const uint8_t* data, size_t len);
+void kuz_omac_final(kuz_omac_t* st, uint8_t* mac, size_t maclen);
+
+// MACs of count independent messages msg[i] of len[i] bytes, written to
+// macs + i*maclen. Up to KUZ_CTR_BATCH messages are chained side by side.
+void kuz_omac_batch(const kuz_omac_key_t* key, const uint8_t* const* msg, const size_t* len,
+                    uint8_t* macs, size_t maclen, size_t count);
+
+/*****************************************************************************/
+/* KExp15 / KImp15 key wrap (kuznyechik_kexp.c, needs the MAC)               */
+/*****************************************************************************/
+
+#define KUZ_KEXP_IV_SIZE (KUZ_BLOCK_SIZE/2)
+#define KUZ_KEXP_SIZE    (KUZ_KEY_SIZE + KUZ_BLOCK_SIZE)   // wrapped key : K || MAC, encrypted
+
+// Wrap key (32 bytes) into wrapped (KUZ_KEXP_SIZE bytes), with the MAC key
+// mac and the encryption key enc. Use a fresh iv for every wrap.
+void kuz_kexp15(const kuz_omac_key_t* mac, const kuz_ctx_t* enc, const uint8_t* iv, const uint8_t* key, uint8_t* wrapped);
+
+// Unwrap into key : 0, or -1 and a zeroed key if the MAC does not match.
+// One key at a time, with a frame of about 200 bytes.
+int kuz_kimp15(const kuz_omac_key_t* mac, const kuz_ctx_t* enc, const uint8_t* iv, const uint8_t* wrapped, uint8_t* key);
+
+// Unwrap count keys : ivs, wrapped and keys are packed arrays of
+// KUZ_KEXP_IV_SIZE, KUZ_KEXP_SIZE and KUZ_KEY_SIZE byte entries. Returns the
+// number of keys whose MAC does not match; those are zeroed.
+size_t kuz_kimp15_batch(const kuz_omac_key_t* mac, const kuz_ctx_t* enc, const uint8_t* ivs,
+                        const uint8_t* wrapped, uint8_t* keys, size_t count);
+
+/*****************************************************************************/
+/* MGM authenticated encryption (kuznyechik_mgm.c)                           */
+/*****************************************************************************/
+
+#define KUZ_MGM_NONCE_SIZE KUZ_BLOCK_SIZE
+#define KUZ_MGM_TAG_SIZE   KUZ_BLOCK_SIZE
+
+// State of one message. It points to ctx, which must outlive it.
+typedef struct
+{
+  const kuz_ctx_t* ctx;
+  uint8_t  y[KUZ_BLOCK_SIZE];    // next encryption counter
+  uint8_t  z[KUZ_BLOCK_SIZE];    // next authentication counter
+  uint64_t sum[2];               // running GF(2^128) sum, high half in sum[1]
+  uint64_t alen, clen;           // bytes of A and C so far
+  uint8_t  buf[KUZ_BLOCK_SIZE];  // partial block of A or C not yet authenticated
+  uint8_t  ks[KUZ_BLOCK_SIZE];   // keystream of the partial block of C
+  uint8_t  buflen;
+  uint8_t  data;                 // encryption started, no more A
+  uint8_t  pclmul;               // products with PCLMULQDQ (x86-64 CPUs that have it)
+} kuz_mgm_t;
+
+// The nonce is 16 bytes, its first bit is ignored (forced to 0 / 1 for the
+// two counters). Never reuse a nonce with the same key.
+void kuz_mgm_init(kuz_mgm_t* st, const kuz_ctx_t* ctx, const uint8_t* nonce);
+
+// Associated data, in as many calls as needed : -1 once encryption started.
+int kuz_mgm_aad(kuz_mgm_t* st, const uint8_t* aad, size_t len);
+
+// Data, in as many calls of any length as needed. in and out may be the
+// same buffer. kuz_mgm_decrypt releases plaintext before the tag is checked :
+// discard it if kuz_mgm_verify fails.
+void kuz_mgm_encrypt(kuz_mgm_t* st, const uint8_t* in, uint8_t* out, size_t len);
+void kuz_mgm_decrypt(kuz_mgm_t* st, const uint8_t* in, uint8_t* out, size_t len);
+
+// Write the first taglen (1..16) bytes of the tag, or compare them with tag
+// in constant time (0 if equal, -1 otherwise). Both wipe the state.
+void kuz_mgm_final(kuz_mgm_t* st, uint8_t* tag, size_t taglen);
+int kuz_mgm_verify(kuz_mgm_t* st, const uint8_t* tag, size_t taglen);
+
+/*****************************************************************************/
+/* Thread pool (kuznyechik_parallel.c, pthreads)                             */
+/*****************************************************************************/
+
+// Blocks per unit of work handed to a thread (64KB)
+#define KUZ_POOL_CHUNK 4096
+
+typedef struct kuz_pool kuz_pool_t;
+
+// Start threads workers (1 if 0 is given). NULL if they cannot be created.
+kuz_pool_t* kuz_pool_create(unsigned threads);
+void kuz_pool_destroy(kuz_pool_t* pool);
+unsigned kuz_pool_threads(const kuz_pool_t* pool);
+
+// The buffer is cut in KUZ_POOL_CHUNK-block pieces spread over the workers;
+// each worker runs on its own copy of ctx. Same results as the single-thread
+// calls. The pool runs one job at a time : do not share it between callers.
+void kuz_ecb_encrypt_mt(kuz_pool_t* pool, const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out, size_t blocks);
+void kuz_ecb_decrypt_mt(kuz_pool_t* pool, const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out, size_t blocks);
+void kuz_ctr_xor_mt(kuz_pool_t* pool, const kuz_ctx_t* ctx, const uint8_t* iv, const uint8_t* in, uint8_t* out, size_t len);
+
+#endif //_KUZNYECHIK_MODES_H_
@@ -0,0 +1,184 @@
+/* MAC of GOST R 34.13-2015 (section 5.6, OMAC1 / CMAC) for Kuznyechik. */
+
+/*
+
+  R = E(0^128), K1 = R << 1 (^ 0x87 if the MSB of R is set), K2 = K1 << 1 (same)
+  MAC = first bytes of the CBC-MAC of P, whose last block is P* ^ K1 when
+  whole, (P* || 1 || 0...0) ^ K2 otherwise.
+
+K1 and K2 are derived once per key in a kuz_omac_key_t. The chain of one
+message is serial; kuz_omac_batch() advances up to KUZ_CTR_BATCH messages
+together, one block of each per kuz_encrypt_blocks() call, so the SIMD and
+table engines get full groups.
+
+Test vector (GOST R 34.13-2015, A.1.6), with the key of kuznyechik.c and the
+four plaintext blocks of the CTR example : MAC (64 bits) = 336f4d296059fbe3
+
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include "kuznyechik.h"
+#include "kuznyechik_modes.h"
+
+// b = a << 1 over the block, ^ 0x87 on the last byte if a bit is shifted out
+static void Double(uint8_t* b, const uint8_t* a)
+{
+  uint8_t carry = a[0] >> 7;
+  uint8_t i;
+
+  for(i=0;i<KUZ_BLOCK_SIZE-1;i++)
+  {
+    b[i] = (uint8_t)(a[i] << 1) | (a[i + 1] >> 7);
+  }
+  b[KUZ_BLOCK_SIZE-1] = (uint8_t)(a[KUZ_BLOCK_SIZE-1] << 1) ^ (0x87 & (0 - carry));
+}
+
+static void Xor(uint8_t* a, const uint8_t* b, size_t len)
+{
+  size_t i;
+  for(i=0;i<len;i++)
+  {
+    a[i] ^= b[i];
+  }
+}
+
+// a ^= last block of a message (len bytes, 0..16) with its padding and subkey
+static void XorLast(const kuz_omac_key_t* key, uint8_t* a, const uint8_t* last, size_t len)
+{
+  Xor(a, last, len);
+  if(len == KUZ_BLOCK_SIZE)
+  {
+    Xor(a, key->k1, KUZ_BLOCK_SIZE);
+  }
+  else
+  {
+    a[len] ^= 0x80;
+    Xor(a, key->k2, KUZ_BLOCK_SIZE);
+  }
+}
+
+/*****************************************************************************/
+/* Public functions:                                                         */
+/*****************************************************************************/
+
+void kuz_omac_key_init(kuz_omac_key_t* key, const kuz_ctx_t* ctx)
+{
+  uint8_t r[KUZ_BLOCK_SIZE];
+
+  key->ctx = ctx;
+  memset(r, 0, KUZ_BLOCK_SIZE);
+  kuz_encrypt(ctx, r, r);
+  Double(key->k1, r);
+  Double(key->k2, key->k1);
+  kuz_wipe(r, KUZ_BLOCK_SIZE);
+}
+
+void kuz_omac_init(kuz_omac_t* st, const kuz_omac_key_t* key)
+{
+  st->key = key;
+  memset(st->acc, 0, KUZ_BLOCK_SIZE);
+  st->buflen = 0;
+}
+
+// The last block is kept in buf until kuz_omac_final() : only then is it
+// known to be the last one.
+void kuz_omac_update(kuz_omac_t* st, const uint8_t* data, size_t len)
+{
+  size_t n;
+
+  while(len > 0)
+  {
+    if(st->buflen == KUZ_BLOCK_SIZE)
+    {
+      Xor(st->acc, st->buf, KUZ_BLOCK_SIZE);
+      kuz_encrypt(st->key->ctx, st->acc, st->acc);
+      st->buflen = 0;
+    }
+    if(st->buflen == 0)
+    {
+      // Whole blocks straight from the caller's buffer, all but the last
+      for(; len > KUZ_BLOCK_SIZE; len -= KUZ_BLOCK_SIZE, data += KUZ_BLOCK_SIZE)
+      {
+        Xor(st->acc, data, KUZ_BLOCK_SIZE);
+        kuz_encrypt(st->key->ctx, st->acc, st->acc);
+      }
+    }
+    n = (size_t)(KUZ_BLOCK_SIZE - st->buflen) < len ? (size_t)(KUZ_BLOCK_SIZE - st->buflen) : len;
+    memcpy(st->buf + st->buflen, data, n);
+    st->buflen += (uint8_t)n;
+    data += n;
+    len -= n;
+  }
+}
+
+void kuz_omac_final(kuz_omac_t* st, uint8_t* mac, size_t maclen)
+{
+  XorLast(st->key, st->acc, st->buf, st->buflen);
+  kuz_encrypt(st->key->ctx, st->acc, st->acc);
+  memcpy(mac, st->acc, maclen < KUZ_BLOCK_SIZE ? maclen : KUZ_BLOCK_SIZE);
+  kuz_wipe(st, sizeof(kuz_omac_t));
+}
+
+void kuz_omac_batch(const kuz_omac_key_t* key, const uint8_t* const* msg, const size_t* len,
+                    uint8_t* macs, size_t maclen, size_t count)
+{
+  uint8_t acc[KUZ_CTR_BATCH][KUZ_BLOCK_SIZE];
+  uint8_t work[KUZ_CTR_BATCH*KUZ_BLOCK_SIZE];
+  size_t blocks[KUZ_CTR_BATCH];
+  uint8_t map[KUZ_CTR_BATCH];
+  size_t group, steps, step, m, n, used = 0;
+
+  if(maclen > KUZ_BLOCK_SIZE)
+  {
+    maclen = KUZ_BLOCK_SIZE;
+  }
+  for(; count > 0; count -= group, msg += group, len += group, macs += group*maclen)
+  {
+    group = count < KUZ_CTR_BATCH ? count : KUZ_CTR_BATCH;
+    used = group > used ? group : used;
+    steps = 0;
+    for(m=0;m<group;m++)
+    {
+      // An empty message still has one (padding) block
+      blocks[m] = len[m] == 0 ? 1 : (len[m] + KUZ_BLOCK_SIZE - 1) / KUZ_BLOCK_SIZE;
+      steps = blocks[m] > steps ? blocks[m] : steps;
+    }
+    memset(acc, 0, sizeof(acc));
+
+    // Step i : block i of every message that has one, in one call
+    for(step=0;step<steps;step++)
+    {
+      n = 0;
+      for(m=0;m<group;m++)
+      {
+        if(step >= blocks[m])
+        {
+          continue;
+        }
+        memcpy(work + n*KUZ_BLOCK_SIZE, acc[m], KUZ_BLOCK_SIZE);
+        if(step + 1 < blocks[m])
+        {
+          Xor(work + n*KUZ_BLOCK_SIZE, msg[m] + step*KUZ_BLOCK_SIZE, KUZ_BLOCK_SIZE);
+        }
+        else
+        {
+          XorLast(key, work + n*KUZ_BLOCK_SIZE, msg[m] + step*KUZ_BLOCK_SIZE, len[m] - step*KUZ_BLOCK_SIZE);
+        }
+        map[n++] = (uint8_t)m;
+      }
+      kuz_encrypt_blocks(key->ctx, work, work, n);
+      for(m=0;m<n;m++)
+      {
+        memcpy(acc[map[m]], work + m*KUZ_BLOCK_SIZE, KUZ_BLOCK_SIZE);
+      }
+    }
+
+    for(m=0;m<group;m++)
+    {
+      memcpy(macs + m*maclen, acc[m], maclen);
+    }
+  }
+  kuz_wipe(acc, used*KUZ_BLOCK_SIZE);
+  kuz_wipe(work, used*KUZ_BLOCK_SIZE);
+}
@@ -0,0 +1,231 @@
+/* Thread pool running ECB and CTR over large buffers (host builds, pthreads). */
+
+/*
+
+A job is cut in chunks of KUZ_POOL_CHUNK blocks that the workers pull from a
+shared atomic index, so a slow or preempted thread does not hold the others
+back. Each worker copies the caller's context into its own 64-byte aligned
+slot before starting : no two threads share a cache line of key material.
+
+ECB chunks are independent by construction, CTR chunks start their counter
+at the chunk's first block (kuz_ctr_xor_from).
+
+*/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "kuznyechik.h"
+#include "kuznyechik_modes.h"
+
+#define CACHE_LINE 64
+
+typedef enum
+{
+  JOB_ECB_ENCRYPT,
+  JOB_ECB_DECRYPT,
+  JOB_CTR
+} kuz_job_type_t;
+
+typedef struct
+{
+  kuz_job_type_t  type;
+  const kuz_ctx_t* ctx;
+  const uint8_t*  iv;
+  const uint8_t*  in;
+  uint8_t*        out;
+  size_t          len;      // bytes
+  size_t          chunks;
+  size_t          next;     // next chunk to run, shared by the workers
+} kuz_job_t;
+
+// One slot per worker, alone on its cache lines
+typedef struct
+{
+  kuz_ctx_t ctx;
+  struct kuz_pool* pool;
+  pthread_t tid;
+} __attribute__((aligned(CACHE_LINE))) kuz_worker_t;
+
+struct kuz_pool
+{
+  unsigned        threads;
+  kuz_worker_t*   workers;
+  pthread_mutex_t lock;
+  pthread_cond_t  wake;
+  pthread_cond_t  idle;
+  unsigned        generation;  // bumped for every job
+  unsigned        busy;        // workers still on the current job
+  int             quit;
+  kuz_job_t       job;
+};
+
+static void RunChunk(const kuz_job_t* job, const kuz_ctx_t* ctx, size_t chunk)
+{
+  size_t first = chunk*KUZ_POOL_CHUNK*KUZ_BLOCK_SIZE;
+  size_t bytes = KUZ_POOL_CHUNK*KUZ_BLOCK_SIZE;
+
+  if(first + bytes > job->len)
+  {
+    bytes = job->len - first;
+  }
+  switch(job->type)
+  {
+    case JOB_ECB_ENCRYPT:
+      kuz_encrypt_blocks(ctx, job->in + first, job->out + first, bytes/KUZ_BLOCK_SIZE);
+      break;
+    case JOB_ECB_DECRYPT:
+      kuz_decrypt_blocks(ctx, job->in + first, job->out + first, bytes/KUZ_BLOCK_SIZE);
+      break;
+    case JOB_CTR:
+      kuz_ctr_xor_from(ctx, job->iv, first/KUZ_BLOCK_SIZE, job->in + first, job->out + first, bytes);
+      break;
+  }
+}
+
+static void* Worker(void* arg)
+{
+  kuz_worker_t* self = (kuz_worker_t*)arg;
+  struct kuz_pool* pool = self->pool;
+  unsigned seen = 0;
+  size_t chunk;
+
+  pthread_mutex_lock(&pool->lock);
+  for(;;)
+  {
+    while(pool->generation == seen && !pool->quit)
+    {
+      pthread_cond_wait(&pool->wake, &pool->lock);
+    }
+    if(pool->quit)
+    {
+      break;
+    }
+    seen = pool->generation;
+    memcpy(&self->ctx, pool->job.ctx, sizeof(kuz_ctx_t));
+    pthread_mutex_unlock(&pool->lock);
+
+    while((chunk = __atomic_fetch_add(&pool->job.next, 1, __ATOMIC_RELAXED)) < pool->job.chunks)
+    {
+      RunChunk(&pool->job, &self->ctx, chunk);
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    if(--pool->busy == 0)
+    {
+      pthread_cond_signal(&pool->idle);
+    }
+  }
+  pthread_mutex_unlock(&pool->lock);
+  return NULL;
+}
+
+kuz_pool_t* kuz_pool_create(unsigned threads)
+{
+  kuz_pool_t* pool;
+  unsigned i;
+
+  if(threads == 0)
+  {
+    threads = 1;
+  }
+  pool = (kuz_pool_t*)calloc(1, sizeof(kuz_pool_t));
+  if(pool == NULL)
+  {
+    return NULL;
+  }
+  if(posix_memalign((void**)&pool->workers, CACHE_LINE, threads*sizeof(kuz_worker_t)) != 0)
+  {
+    free(pool);
+    return NULL;
+  }
+  pool->threads = threads;
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_cond_init(&pool->wake, NULL);
+  pthread_cond_init(&pool->idle, NULL);
+
+  for(i=0;i<threads;i++)
+  {
+    pool->workers[i].pool = pool;
+    if(pthread_create(&pool->workers[i].tid, NULL, Worker, &pool->workers[i]) != 0)
+    {
+      pool->threads = i;
+      kuz_pool_destroy(pool);
+      return NULL;
+    }
+  }
+  return pool;
+}
+
+void kuz_pool_destroy(kuz_pool_t* pool)
+{
+  unsigned i;
+
+  if(pool == NULL)
+  {
+    return;
+  }
+  pthread_mutex_lock(&pool->lock);
+  pool->quit = 1;
+  pthread_cond_broadcast(&pool->wake);
+  pthread_mutex_unlock(&pool->lock);
+  for(i=0;i<pool->threads;i++)
+  {
+    pthread_join(pool->workers[i].tid, NULL);
+  }
+  pthread_cond_destroy(&pool->idle);
+  pthread_cond_destroy(&pool->wake);
+  pthread_mutex_destroy(&pool->lock);
+  free(pool->workers);
+  free(pool);
+}
+
+unsigned kuz_pool_threads(const kuz_pool_t* pool)
+{
+  return pool->threads;
+}
+
+// Publish the job, wake every worker and wait until all of them are done
+static void RunJob(kuz_pool_t* pool, kuz_job_type_t type, const kuz_ctx_t* ctx, const uint8_t* iv,
+                   const uint8_t* in, uint8_t* out, size_t len)
+{
+  size_t chunkBytes = KUZ_POOL_CHUNK*KUZ_BLOCK_SIZE;
+
+  if(len == 0)
+  {
+    return;
+  }
+  pthread_mutex_lock(&pool->lock);
+  pool->job.type = type;
+  pool->job.ctx = ctx;
+  pool->job.iv = iv;
+  pool->job.in = in;
+  pool->job.out = out;
+  pool->job.len = len;
+  pool->job.chunks = (len + chunkBytes - 1) / chunkBytes;
+  pool->job.next = 0;
+  pool->busy = pool->threads;
+  pool->generation++;
+  pthread_cond_broadcast(&pool->wake);
+  while(pool->busy != 0)
+  {
+    pthread_cond_wait(&pool->idle, &pool->lock);
+  }
+  pthread_mutex_unlock(&pool->lock);
+}
+
+void kuz_ecb_encrypt_mt(kuz_pool_t* pool, const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out, size_t blocks)
+{
+  RunJob(pool, JOB_ECB_ENCRYPT, ctx, NULL, in, out, blocks*KUZ_BLOCK_SIZE);
+}
+
+void kuz_ecb_decrypt_mt(kuz_pool_t* pool, const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out, size_t blocks)
+{
+  RunJob(pool, JOB_ECB_DECRYPT, ctx, NULL, in, out, blocks*KUZ_BLOCK_SIZE);
+}
+
+void kuz_ctr_xor_mt(kuz_pool_t* pool, const kuz_ctx_t* ctx, const uint8_t* iv, const uint8_t* in, uint8_t* out, size_t len)
+{
+  RunJob(pool, JOB_CTR, ctx, iv, in, out, len);
+}
@@ -0,0 +1,583 @@
+/* x86-64 host kernels for the Kuznyechik LS-tables engine. */
+
+/*
+
+Each round of CipherLS()/InvCipherLS() is 16 lookups of 128-bit table
+entries and 15 XORs. Here the entries are loaded straight into XMM/YMM
+registers and several independent blocks are processed per call, so the
+lookups of one block overlap the XOR chain of the others :
+
+  SSE4.1 : 4 blocks per group, one block per XMM register (PEXTRB indices)
+  AVX2   : 8 blocks per group, two blocks per YMM register
+
+On CPUs with GFNI and AVX-512 (Ice Lake and newer) the tables are not used
+at all : 16 blocks per group, L and L^-1 as GF2P8AFFINEQB products, see below.
+
+The kernel is chosen at run time from CPUID by kuz_x86_init(), or forced to
+a narrower one with the KUZ_X86_KERNEL environment variable (tests). Groups
+are always whole, the remaining blocks are left to the portable code of
+kuznyechik.c.
+
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+#include "kuznyechik.h"
+#include "kuznyechik_internal.h"
+
+#if defined(KUZNYECHIK_SIMD) && defined(__x86_64__)
+
+#include <stdlib.h>
+#include <string.h>
+#include <immintrin.h>
+
+#define SSE41 __attribute__((target("sse4.1")))
+#define AVX2  __attribute__((target("avx2")))
+
+#define SSE_LANES 4
+#define AVX_LANES 8
+
+// The rounds are fully unrolled so PEXTRB gets its immediate byte index.
+#define LS_GET(T, x, i)  _mm_loadu_si128((const __m128i*)T[i][_mm_extract_epi8(x, i)].b)
+
+static SSE41 inline __m128i LSpass_SSE41(const lsblock_t T[16][256], __m128i x)
+{
+  __m128i y0, y1;
+
+  y0 = _mm_xor_si128(LS_GET(T, x, 0), LS_GET(T, x, 1));
+  y1 = _mm_xor_si128(LS_GET(T, x, 2), LS_GET(T, x, 3));
+  y0 = _mm_xor_si128(y0, _mm_xor_si128(LS_GET(T, x, 4), LS_GET(T, x, 5)));
+  y1 = _mm_xor_si128(y1, _mm_xor_si128(LS_GET(T, x, 6), LS_GET(T, x, 7)));
+  y0 = _mm_xor_si128(y0, _mm_xor_si128(LS_GET(T, x, 8), LS_GET(T, x, 9)));
+  y1 = _mm_xor_si128(y1, _mm_xor_si128(LS_GET(T, x, 10), LS_GET(T, x, 11)));
+  y0 = _mm_xor_si128(y0, _mm_xor_si128(LS_GET(T, x, 12), LS_GET(T, x, 13)));
+  y1 = _mm_xor_si128(y1, _mm_xor_si128(LS_GET(T, x, 14), LS_GET(T, x, 15)));
+  return _mm_xor_si128(y0, y1);
+}
+
+// Two entries, one per 128-bit half : the low half indexes with byte i of
+// block a, the high half with byte i of block b.
+#define LS_GET2(T, a, b, i)  _mm256_inserti128_si256(_mm256_castsi128_si256(LS_GET(T, a, i)), LS_GET(T, b, i), 1)
+
+static AVX2 inline __m256i LSpass_AVX2(const lsblock_t T[16][256], __m256i x)
+{
+  __m128i a = _mm256_castsi256_si128(x);
+  __m128i b = _mm256_extracti128_si256(x, 1);
+  __m256i y0, y1;
+
+  y0 = _mm256_xor_si256(LS_GET2(T, a, b, 0), LS_GET2(T, a, b, 1));
+  y1 = _mm256_xor_si256(LS_GET2(T, a, b, 2), LS_GET2(T, a, b, 3));
+  y0 = _mm256_xor_si256(y0, _mm256_xor_si256(LS_GET2(T, a, b, 4), LS_GET2(T, a, b, 5)));
+  y1 = _mm256_xor_si256(y1, _mm256_xor_si256(LS_GET2(T, a, b, 6), LS_GET2(T, a, b, 7)));
+  y0 = _mm256_xor_si256(y0, _mm256_xor_si256(LS_GET2(T, a, b, 8), LS_GET2(T, a, b, 9)));
+  y1 = _mm256_xor_si256(y1, _mm256_xor_si256(LS_GET2(T, a, b, 10), LS_GET2(T, a, b, 11)));
+  y0 = _mm256_xor_si256(y0, _mm256_xor_si256(LS_GET2(T, a, b, 12), LS_GET2(T, a, b, 13)));
+  y1 = _mm256_xor_si256(y1, _mm256_xor_si256(LS_GET2(T, a, b, 14), LS_GET2(T, a, b, 15)));
+  return _mm256_xor_si256(y0, y1);
+}
+
+// S(x) byte by byte, used to turn the first ILS_dec pass into L^-1 alone
+// (the ILS_dec entries of S(v) are L^-1(v)), as InvCipherLS() does.
+static SSE41 inline __m128i Sbytes_SSE41(const uint8_t* box, __m128i x)
+{
+  uint8_t b[16];
+  uint8_t i;
+
+  _mm_storeu_si128((__m128i*)b, x);
+  for(i=0;i<16;i++)
+  {
+    b[i] = box[b[i]];
+  }
+  return _mm_loadu_si128((const __m128i*)b);
+}
+
+/*****************************************************************************/
+/* SSE4.1                                                                    */
+/*****************************************************************************/
+
+static SSE41 void Encrypt_SSE41(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out)
+{
+  __m128i x[SSE_LANES], k;
+  uint8_t round, l;
+
+  for(l=0;l<SSE_LANES;l++)
+  {
+    x[l] = _mm_loadu_si128((const __m128i*)(in + l*KUZ_BLOCK_SIZE));
+  }
+  for(round=0;round<9;round++)
+  {
+    k = _mm_loadu_si128((const __m128i*)ctx->rk[round]);
+    for(l=0;l<SSE_LANES;l++)
+    {
+      x[l] = LSpass_SSE41(LS_enc, _mm_xor_si128(x[l], k));
+    }
+  }
+  k = _mm_loadu_si128((const __m128i*)ctx->rk[9]);
+  for(l=0;l<SSE_LANES;l++)
+  {
+    _mm_storeu_si128((__m128i*)(out + l*KUZ_BLOCK_SIZE), _mm_xor_si128(x[l], k));
+  }
+}
+
+static SSE41 void Decrypt_SSE41(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out)
+{
+  __m128i x[SSE_LANES], k;
+  uint8_t round, l;
+
+  for(l=0;l<SSE_LANES;l++)
+  {
+    x[l] = _mm_loadu_si128((const __m128i*)(in + l*KUZ_BLOCK_SIZE));
+    x[l] = LSpass_SSE41(ILS_dec, Sbytes_SSE41(sbox, x[l]));
+  }
+  for(round=9;round>1;round--)
+  {
+    k = _mm_loadu_si128((const __m128i*)ctx->rkd[round]);
+    for(l=0;l<SSE_LANES;l++)
+    {
+      x[l] = LSpass_SSE41(ILS_dec, _mm_xor_si128(x[l], k));
+    }
+  }
+  k = _mm_loadu_si128((const __m128i*)ctx->rkd[1]);
+  for(l=0;l<SSE_LANES;l++)
+  {
+    x[l] = Sbytes_SSE41(rsbox, _mm_xor_si128(x[l], k));
+  }
+  k = _mm_loadu_si128((const __m128i*)ctx->rk[0]);
+  for(l=0;l<SSE_LANES;l++)
+  {
+    _mm_storeu_si128((__m128i*)(out + l*KUZ_BLOCK_SIZE), _mm_xor_si128(x[l], k));
+  }
+}
+
+/*****************************************************************************/
+/* AVX2                                                                      */
+/*****************************************************************************/
+
+static AVX2 inline __m256i RoundKey_AVX2(const uint8_t* rk)
+{
+  return _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)rk));
+}
+
+static AVX2 void Encrypt_AVX2(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out)
+{
+  __m256i x[AVX_LANES/2], k;
+  uint8_t round, l;
+
+  for(l=0;l<AVX_LANES/2;l++)
+  {
+    x[l] = _mm256_loadu_si256((const __m256i*)(in + 2*l*KUZ_BLOCK_SIZE));
+  }
+  for(round=0;round<9;round++)
+  {
+    k = RoundKey_AVX2(ctx->rk[round]);
+    for(l=0;l<AVX_LANES/2;l++)
+    {
+      x[l] = LSpass_AVX2(LS_enc, _mm256_xor_si256(x[l], k));
+    }
+  }
+  k = RoundKey_AVX2(ctx->rk[9]);
+  for(l=0;l<AVX_LANES/2;l++)
+  {
+    _mm256_storeu_si256((__m256i*)(out + 2*l*KUZ_BLOCK_SIZE), _mm256_xor_si256(x[l], k));
+  }
+}
+
+static AVX2 void Decrypt_AVX2(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out)
+{
+  // The byte-wise S / S^-1 steps gain nothing from YMM registers
+  Decrypt_SSE41(ctx, in, out);
+  Decrypt_SSE41(ctx, in + SSE_LANES*KUZ_BLOCK_SIZE, out + SSE_LANES*KUZ_BLOCK_SIZE);
+}
+
+/*****************************************************************************/
+/* GFNI / AVX-512                                                            */
+/*****************************************************************************/
+
+// 8 blocks are transposed over two ZMM registers : qword i of the pair holds
+// byte i of the 8 blocks. Multiplying byte i by a constant of GF(2^8) is an
+// 8x8 bit matrix, and GF2P8AFFINEQB applies one matrix per qword, so :
+//
+//   L(x)[o] = sum_i M[o][i] x[i]  ->  for each i, broadcast qword i and apply
+//                                     the 8 matrices M[0..7][i], M[8..15][i]
+//
+// 32 affine products per L for 8 blocks, with no table lookup. S and S^-1
+// are 256-byte VPERMI2B lookups. Needs AVX512F/BW, AVX512VBMI and GFNI.
+
+#define GFNI __attribute__((target("avx512f,avx512bw,avx512vbmi,gfni")))
+
+#define GFNI_LANES 16
+
+// Lmat[i][h] : matrices of M[8h..8h+7][i], one per qword
+static __m512i Lmat[16][2];
+static __m512i InvLmat[16][2];
+
+// Transposition indices for VPERMT2B, and VPERMB indices spreading a round
+// key the same way
+static __m512i ToT[2];
+static __m512i FromT[2];
+static __m512i KeyT[2];
+
+static void GfniMatrices(__m512i mat[16][2], void (*step)(uint8_t*))
+{
+  uint8_t column[KUZ_BLOCK_SIZE];
+  uint64_t q[16][16];
+  uint8_t i, b, o, r;
+
+  memset(q, 0, sizeof(q));
+  for(i=0;i<16;i++)
+  {
+    for(b=0;b<8;b++)
+    {
+      // image of bit b of byte i : column b of every M[o][i]
+      memset(column, 0, sizeof(column));
+      column[i] = (uint8_t)(1 << b);
+      step(column);
+      for(o=0;o<16;o++)
+      {
+        for(r=0;r<8;r++)
+        {
+          // GF2P8AFFINEQB takes output bit r from byte 7-r of the matrix
+          if((column[o] >> r) & 1)
+          {
+            q[i][o] |= (uint64_t)1 << (8*(7 - r) + b);
+          }
+        }
+      }
+    }
+  }
+  for(i=0;i<16;i++)
+  {
+    memcpy(&mat[i][0], &q[i][0], 64);
+    memcpy(&mat[i][1], &q[i][8], 64);
+  }
+}
+
+static void GfniInit(void)
+{
+  uint8_t to[2][64], from[2][64], key[2][64];
+  uint8_t i, j;
+
+  GfniMatrices(Lmat, kuz_lstep);
+  GfniMatrices(InvLmat, kuz_inv_lstep);
+
+  // transposed byte 8*i+j of register h <-> byte i+8h of block j
+  for(i=0;i<8;i++)
+  {
+    for(j=0;j<8;j++)
+    {
+      to[0][8*i + j] = (uint8_t)(16*j + i);
+      to[1][8*i + j] = (uint8_t)(16*j + i + 8);
+      key[0][8*i + j] = i;
+      key[1][8*i + j] = (uint8_t)(i + 8);
+    }
+  }
+  for(j=0;j<8;j++)
+  {
+    for(i=0;i<16;i++)
+    {
+      from[j >> 2][16*(j & 3) + i] = (uint8_t)(64*(i >> 3) + 8*(i & 7) + j);
+    }
+  }
+  memcpy(&ToT[0], to[0], 64);
+  memcpy(&ToT[1], to[1], 64);
+  memcpy(&FromT[0], from[0], 64);
+  memcpy(&FromT[1], from[1], 64);
+  memcpy(&KeyT[0], key[0], 64);
+  memcpy(&KeyT[1], key[1], 64);
+}
+
+static GFNI inline void GfniLoad(__m512i* x, const uint8_t* in)
+{
+  __m512i a = _mm512_loadu_si512((const void*)in);
+  __m512i b = _mm512_loadu_si512((const void*)(in + 64));
+
+  x[0] = _mm512_permutex2var_epi8(a, ToT[0], b);
+  x[1] = _mm512_permutex2var_epi8(a, ToT[1], b);
+}
+
+static GFNI inline void GfniStore(uint8_t* out, const __m512i* x)
+{
+  _mm512_storeu_si512((void*)out, _mm512_permutex2var_epi8(x[0], FromT[0], x[1]));
+  _mm512_storeu_si512((void*)(out + 64), _mm512_permutex2var_epi8(x[0], FromT[1], x[1]));
+}
+
+// Round key byte i+8h repeated over qword i of register h
+static GFNI inline void GfniRoundKey(__m512i* k, const uint8_t* rk)
+{
+  __m512i key = _mm512_castsi128_si512(_mm_loadu_si128((const __m128i*)rk));
+
+  k[0] = _mm512_permutexvar_epi8(KeyT[0], key);
+  k[1] = _mm512_permutexvar_epi8(KeyT[1], key);
+}
+
+// 256-byte table as four registers, bit 7 of the index picks the pair
+static GFNI inline __m512i GfniSbox(const __m512i* t, __m512i x)
+{
+  __m512i lo = _mm512_permutex2var_epi8(t[0], x, t[1]);
+  __m512i hi = _mm512_permutex2var_epi8(t[2], x, t[3]);
+
+  return _mm512_mask_blend_epi8(_mm512_movepi8_mask(x), lo, hi);
+}
+
+static GFNI inline void GfniLstep(__m512i* x, const __m512i mat[16][2])
+{
+  __m512i y0 = _mm512_setzero_si512();
+  __m512i y1 = _mm512_setzero_si512();
+  __m512i xi;
+  uint8_t i;
+
+  for(i=0;i<16;i++)
+  {
+    xi = _mm512_permutexvar_epi64(_mm512_set1_epi64(i & 7), x[i >> 3]);
+    y0 = _mm512_xor_si512(y0, _mm512_gf2p8affine_epi64_epi8(xi, mat[i][0], 0));
+    y1 = _mm512_xor_si512(y1, _mm512_gf2p8affine_epi64_epi8(xi, mat[i][1], 0));
+  }
+  x[0] = y0;
+  x[1] = y1;
+}
+
+static GFNI inline void GfniTable(__m512i* t, const uint8_t* box)
+{
+  uint8_t h;
+  for(h=0;h<4;h++)
+  {
+    t[h] = _mm512_loadu_si512((const void*)(box + 64*h));
+  }
+}
+
+static GFNI void Encrypt_GFNI(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out)
+{
+  __m512i x[2][2], k[2], t[4];
+  uint8_t round, g;
+
+  GfniTable(t, sbox);
+  GfniLoad(x[0], in);
+  GfniLoad(x[1], in + 8*KUZ_BLOCK_SIZE);
+  for(round=0;round<9;round++)
+  {
+    GfniRoundKey(k, ctx->rk[round]);
+    for(g=0;g<2;g++)
+    {
+      x[g][0] = GfniSbox(t, _mm512_xor_si512(x[g][0], k[0]));
+      x[g][1] = GfniSbox(t, _mm512_xor_si512(x[g][1], k[1]));
+      GfniLstep(x[g], Lmat);
+    }
+  }
+  GfniRoundKey(k, ctx->rk[9]);
+  for(g=0;g<2;g++)
+  {
+    x[g][0] = _mm512_xor_si512(x[g][0], k[0]);
+    x[g][1] = _mm512_xor_si512(x[g][1], k[1]);
+    GfniStore(out + 8*g*KUZ_BLOCK_SIZE, x[g]);
+  }
+}
+
+static GFNI void Decrypt_GFNI(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out)
+{
+  __m512i x[2][2], k[2], t[4];
+  uint8_t round, g;
+
+  GfniTable(t, rsbox);
+  GfniLoad(x[0], in);
+  GfniLoad(x[1], in + 8*KUZ_BLOCK_SIZE);
+  for(round=9;round>0;round--)
+  {
+    GfniRoundKey(k, ctx->rk[round]);
+    for(g=0;g<2;g++)
+    {
+      x[g][0] = _mm512_xor_si512(x[g][0], k[0]);
+      x[g][1] = _mm512_xor_si512(x[g][1], k[1]);
+      GfniLstep(x[g], InvLmat);
+      x[g][0] = GfniSbox(t, x[g][0]);
+      x[g][1] = GfniSbox(t, x[g][1]);
+    }
+  }
+  GfniRoundKey(k, ctx->rk[0]);
+  for(g=0;g<2;g++)
+  {
+    x[g][0] = _mm512_xor_si512(x[g][0], k[0]);
+    x[g][1] = _mm512_xor_si512(x[g][1], k[1]);
+    GfniStore(out + 8*g*KUZ_BLOCK_SIZE, x[g]);
+  }
+}
+
+// KeyExpansion() with L(S(a ^ C[i])) on the transposed state, followed by
+// the L^-1 decryption keys of KeyExpansionLS(). In the Feistel steps the
+// single block is spread over the 8 lanes like a round key, so no
+// transposition is needed on the way in, and lane 0 is read back.
+static GFNI void KeyExpansion_GFNI(kuz_ctx_t* ctx, const uint8_t* key, const uint8_t (*c)[KUZ_BLOCK_SIZE])
+{
+  uint8_t keys[16][KUZ_BLOCK_SIZE];
+  __m128i a, b, y;
+  __m512i x[2], t[4];
+  uint8_t i;
+
+  GfniTable(t, sbox);
+  a = _mm_loadu_si128((const __m128i*)key);
+  b = _mm_loadu_si128((const __m128i*)(key + KUZ_BLOCK_SIZE));
+  _mm_storeu_si128((__m128i*)ctx->rk[0], a);
+  _mm_storeu_si128((__m128i*)ctx->rk[1], b);
+
+  for(i=0;i<32;i++)
+  {
+    // (a, b) <- (L(S(a ^ C[i])) ^ b, a)
+    y = _mm_xor_si128(a, _mm_loadu_si128((const __m128i*)c[i]));
+    x[0] = GfniSbox(t, _mm512_permutexvar_epi8(KeyT[0], _mm512_castsi128_si512(y)));
+    x[1] = GfniSbox(t, _mm512_permutexvar_epi8(KeyT[1], _mm512_castsi128_si512(y)));
+    GfniLstep(x, Lmat);
+    y = _mm512_castsi512_si128(_mm512_permutex2var_epi8(x[0], FromT[0], x[1]));
+    y = _mm_xor_si128(y, b);
+    b = a;
+    a = y;
+
+    if((i & 7) == 7)
+    {
+      _mm_storeu_si128((__m128i*)ctx->rk[2 + (i >> 2) - 1], a);
+      _mm_storeu_si128((__m128i*)ctx->rk[2 + (i >> 2)], b);
+    }
+  }
+
+  // Equivalent inverse cipher keys L^-1(rk), 8 keys per InvLmat pass
+  memset(keys, 0, sizeof(keys));
+  memcpy(keys, ctx->rk, sizeof(ctx->rk));
+  for(i=0;i<2;i++)
+  {
+    GfniLoad(x, keys[8*i]);
+    GfniLstep(x, InvLmat);
+    GfniStore(keys[8*i], x);
+  }
+  memcpy(ctx->rkd, keys, sizeof(ctx->rkd));
+}
+
+/*****************************************************************************/
+/* Dispatch                                                                  */
+/*****************************************************************************/
+
+typedef void (*kuz_group_fn)(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out);
+
+typedef struct
+{
+  const char*  name;
+  size_t       lanes;
+  kuz_group_fn encrypt;
+  kuz_group_fn decrypt;
+} kuz_x86_kernel_t;
+
+static const kuz_x86_kernel_t kernels[] = {
+  { "gfni-avx512", GFNI_LANES, Encrypt_GFNI, Decrypt_GFNI },
+  { "avx2",   AVX_LANES, Encrypt_AVX2,  Decrypt_AVX2  },
+  { "sse4.1", SSE_LANES, Encrypt_SSE41, Decrypt_SSE41 },
+  { "c",      0,         0,             0             },
+};
+
+// Widest kernel supported by the CPU, looked up by kuz_x86_init().
+static const kuz_x86_kernel_t* selected = &kernels[3];
+
+void kuz_x86_init(void)
+{
+  const char* force = getenv("KUZ_X86_KERNEL");
+  const kuz_x86_kernel_t* k;
+
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+     __builtin_cpu_supports("avx512vbmi") && __builtin_cpu_supports("gfni"))
+  {
+    GfniInit();
+    selected = &kernels[0];
+  }
+  else if(__builtin_cpu_supports("avx2"))
+  {
+    selected = &kernels[1];
+  }
+  else if(__builtin_cpu_supports("sse4.1"))
+  {
+    selected = &kernels[2];
+  }
+
+  // KUZ_X86_KERNEL=avx2 (sse4.1, c...) : a narrower kernel than the CPU's
+  // own, so the tests reach every kernel on one host. Unknown or wider
+  // names are ignored.
+  if(force != NULL)
+  {
+    for(k = selected; k <= &kernels[3]; k++)
+    {
+      if(strcmp(force, k->name) == 0)
+      {
+        selected = k;
+        break;
+      }
+    }
+  }
+}
+
+int kuz_x86_key_expansion(kuz_ctx_t* ctx, const uint8_t* key, const uint8_t (*c)[KUZ_BLOCK_SIZE])
+{
+  if(selected != &kernels[0])
+  {
+    return 0;
+  }
+  KeyExpansion_GFNI(ctx, key, c);
+  return 1;
+}
+
+// Whole groups go through the selected kernel, what is left of them through
+// the narrower ones (an AVX2 CPU still runs 4 of 7 blocks in SSE4.1).
+static size_t Run(int decrypt, const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out, size_t blocks)
+{
+  const kuz_x86_kernel_t* k;
+  size_t done = 0;
+
+  for(k = selected; k->lanes != 0; k++)
+  {
+    for(; done + k->lanes <= blocks; done += k->lanes)
+    {
+      (decrypt ? k->decrypt : k->encrypt)(ctx, in + done*KUZ_BLOCK_SIZE, out + done*KUZ_BLOCK_SIZE);
+    }
+  }
+  return done;
+}
+
+size_t kuz_x86_encrypt_blocks(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out, size_t blocks)
+{
+  return Run(0, ctx, in, out, blocks);
+}
+
+size_t kuz_x86_decrypt_blocks(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out, size_t blocks)
+{
+  return Run(1, ctx, in, out, blocks);
+}
+
+const char* kuz_x86_engine(void)
+{
+  return selected->name;
+}
+
+#elif defined(KUZNYECHIK_SIMD)
+
+// Not an x86-64 target : everything stays on the portable code.
+
+void kuz_x86_init(void)
+{
+}
+
+int kuz_x86_key_expansion(kuz_ctx_t* ctx, const uint8_t* key, const uint8_t (*c)[KUZ_BLOCK_SIZE])
+{
+  return 0;
+}
+
+size_t kuz_x86_encrypt_blocks(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out, size_t blocks)
+{
+  return 0;
+}
+
+size_t kuz_x86_decrypt_blocks(const kuz_ctx_t* ctx, const uint8_t* in, uint8_t* out, size_t blocks)
+{
+  return 0;
+}
+
+const char* kuz_x86_engine(void)
+{
+  return "c";
+}
+
+#endif // KUZNYECHIK_SIMD
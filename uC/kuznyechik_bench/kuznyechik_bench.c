@@ -0,0 +1,664 @@
+/* Host benchmark of the Kuznyechik backends, one JSON object on stdout. */
+
+/*
+
+The makefile builds this file once per backend, BENCH_BACKEND selecting the
+calls being timed :
+
+  ref, ls, simd   kuznyechik.c engines : kuz_encrypt_blocks, and
+                  kuz_ecb_encrypt_mt for more than one thread
+  bitslice        kuz_bs_encrypt (KUZNYECHIK_BITSLICE_WIDTH blocks per pass),
+                  keys by kuz_bs_ctx_init
+  masked          kuznyechik_masked.c, one block per call
+
+For every buffer size from 16 bytes to --max (x4 steps, then --max itself;
+1 GB by default) and every thread count from 1 to --threads (x2 steps,
+then --threads itself; single-thread backends : 1), a buffer is encrypted
+in place until --min-time seconds have passed. Cycles are TSC cycles on
+x86-64, null elsewhere.
+
+The kuz_ctx_t backends then time the modes of kuznyechik_modes.h, one
+thread, in place over --mode-bytes (1 MB by default, at most --max), one
+row per mode and direction in "modes" : ECB, CTR, CTR-ACPKM (4 KB
+sections), CBC / CFB encryption and decryption, OFB, MGM encryption and
+decryption (with the tag), OMAC over the whole buffer or cut into
+KUZ_CTR_BATCH messages for kuz_omac_batch, and kuz_kimp15 /
+kuz_kimp15_batch over the buffer seen as 48-byte wrapped keys. CTR and OFB
+are the same call both ways : one "xor" row. CBC, CFB and OFB use a
+one-block IV. The MGM rows run with the
+multiplier kuz_mgm_init picks, plus "mgm-tables" forcing the 4-bit tables
+where PCLMULQDQ would be used.
+
+table_bytes is given by the makefile (--footprint) : the .data, .rodata and
+.bss of the backend library objects (not the modes), as reported by size -A.
+
+The standard test vector is checked first, encryption and decryption; the
+exit status is 1 if the backend gets it wrong.
+
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_TSC 1
+#else
+#define HAVE_TSC 0
+#endif
+
+#define BENCH_REF      1
+#define BENCH_LS       2
+#define BENCH_SIMD     3
+#define BENCH_BITSLICE 4
+#define BENCH_MASKED   5
+
+#if BENCH_BACKEND == BENCH_MASKED
+#include "kuznyechik_masked.h"
+#else
+#include "kuznyechik.h"
+#include "kuznyechik_modes.h"
+#endif
+#if BENCH_BACKEND == BENCH_SIMD
+#include "kuznyechik_internal.h"
+#endif
+
+#define BLOCK 16
+
+static const uint8_t testKey[32] = {
+  0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+  0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10, 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef };
+static const uint8_t testPt[BLOCK] = {
+  0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x00, 0xff, 0xee, 0xdd, 0xcc, 0xbb, 0xaa, 0x99, 0x88 };
+static const uint8_t testCt[BLOCK] = {
+  0x7f, 0x67, 0x9d, 0x90, 0xbe, 0xbc, 0x24, 0x30, 0x5a, 0x46, 0x8d, 0x42, 0xb9, 0xd4, 0xed, 0xcd };
+
+/*****************************************************************************/
+/* Backend                                                                   */
+/*****************************************************************************/
+
+#if BENCH_BACKEND == BENCH_MASKED
+
+#define BACKEND_NAME "masked"
+#define MAX_THREADS  1
+
+// kuznyechik_masked.c keeps a pointer to the key
+static uint8_t maskedKey[32];
+
+static const char* Engine(void)
+{
+  return "masked";
+}
+
+static void SetKey(const uint8_t* key)
+{
+  memcpy(maskedKey, key, sizeof(maskedKey));
+  kuznyechik_setkey(maskedKey);
+}
+
+static void Encrypt(uint8_t* buf, size_t blocks, unsigned threads)
+{
+  size_t i;
+  (void)threads;
+  for(i=0;i<blocks;i++)
+  {
+    masked_kuznyechik_crypto(buf + i*BLOCK);
+  }
+}
+
+static void Decrypt(uint8_t* buf, size_t blocks)
+{
+  size_t i;
+  for(i=0;i<blocks;i++)
+  {
+    masked_kuznyechik_decrypto(buf + i*BLOCK);
+  }
+}
+
+#else // kuz_ctx_t backends
+
+static kuz_ctx_t ctx;
+
+#if BENCH_BACKEND == BENCH_BITSLICE
+
+// Constant-time key schedule as well. Built with
+// KUZNYECHIK_BITSLICE_ENGINE, so the modes run on it too.
+static void SetKey(const uint8_t* key)
+{
+  kuz_bs_ctx_init(&ctx, key);
+}
+
+#define BACKEND_NAME "bitslice"
+#define MAX_THREADS  1
+
+static const char* Engine(void)
+{
+  static char name[32];
+  snprintf(name, sizeof(name), "bitslice-%d", KUZNYECHIK_BITSLICE_WIDTH);
+  return name;
+}
+
+static void Encrypt(uint8_t* buf, size_t blocks, unsigned threads)
+{
+  (void)threads;
+  kuz_bs_encrypt(&ctx, buf, buf, blocks);
+}
+
+static void Decrypt(uint8_t* buf, size_t blocks)
+{
+  kuz_bs_decrypt(&ctx, buf, buf, blocks);
+}
+
+#else // ref, ls, simd
+
+#define MAX_THREADS 1024
+
+static void SetKey(const uint8_t* key)
+{
+  kuz_ctx_init(&ctx, key);
+}
+
+#if BENCH_BACKEND == BENCH_SIMD
+#define BACKEND_NAME "simd"
+static const char* Engine(void)
+{
+  return kuz_x86_engine();
+}
+#elif BENCH_BACKEND == BENCH_LS
+#define BACKEND_NAME "ls"
+static const char* Engine(void)
+{
+  return "ls-tables";
+}
+#else
+#define BACKEND_NAME "ref"
+static const char* Engine(void)
+{
+  return "reference";
+}
+#endif
+
+static kuz_pool_t* pool = NULL;
+
+static void Encrypt(uint8_t* buf, size_t blocks, unsigned threads)
+{
+  if(threads <= 1)
+  {
+    kuz_encrypt_blocks(&ctx, buf, buf, blocks);
+    return;
+  }
+  if(pool == NULL || kuz_pool_threads(pool) != threads)
+  {
+    kuz_pool_destroy(pool);
+    pool = kuz_pool_create(threads);
+  }
+  kuz_ecb_encrypt_mt(pool, &ctx, buf, buf, blocks);
+}
+
+static void Decrypt(uint8_t* buf, size_t blocks)
+{
+  kuz_decrypt_blocks(&ctx, buf, buf, blocks);
+}
+
+#endif
+#endif // BENCH_BACKEND
+
+/*****************************************************************************/
+/* Modes                                                                     */
+/*****************************************************************************/
+
+#if BENCH_BACKEND == BENCH_MASKED
+
+#define HAVE_MODES 0
+
+#else
+
+#define ACPKM_SECTION 4096
+
+// Registers chained from one call to the next, as a long message would
+static uint8_t modeIv[KUZ_BLOCK_SIZE];
+static uint8_t modeNonce[KUZ_MGM_NONCE_SIZE];
+static kuz_omac_key_t macKey;
+
+static void EcbEncrypt(uint8_t* buf, size_t bytes)
+{
+  kuz_encrypt_blocks(&ctx, buf, buf, bytes / BLOCK);
+}
+
+static void EcbDecrypt(uint8_t* buf, size_t bytes)
+{
+  kuz_decrypt_blocks(&ctx, buf, buf, bytes / BLOCK);
+}
+
+static void CtrXor(uint8_t* buf, size_t bytes)
+{
+  kuz_ctr_xor(&ctx, modeIv, buf, buf, bytes);
+}
+
+static void AcpkmXor(uint8_t* buf, size_t bytes)
+{
+  kuz_acpkm_t st;
+  kuz_acpkm_init(&st, &ctx, modeIv, ACPKM_SECTION);
+  kuz_acpkm_xor(&st, buf, buf, bytes);
+  kuz_acpkm_wipe(&st);
+}
+
+static void CbcEncrypt(uint8_t* buf, size_t bytes)
+{
+  kuz_cbc_encrypt(&ctx, modeIv, KUZ_BLOCK_SIZE, buf, buf, bytes / BLOCK);
+}
+
+static void CbcDecrypt(uint8_t* buf, size_t bytes)
+{
+  kuz_cbc_decrypt(&ctx, modeIv, KUZ_BLOCK_SIZE, buf, buf, bytes / BLOCK);
+}
+
+static void CfbEncrypt(uint8_t* buf, size_t bytes)
+{
+  kuz_cfb_encrypt(&ctx, modeIv, KUZ_BLOCK_SIZE, buf, buf, bytes);
+}
+
+static void CfbDecrypt(uint8_t* buf, size_t bytes)
+{
+  kuz_cfb_decrypt(&ctx, modeIv, KUZ_BLOCK_SIZE, buf, buf, bytes);
+}
+
+static void OfbXor(uint8_t* buf, size_t bytes)
+{
+  kuz_ofb_xor(&ctx, modeIv, KUZ_BLOCK_SIZE, buf, buf, bytes);
+}
+
+static void Mgm(uint8_t* buf, size_t bytes, int encrypt, int tables)
+{
+  uint8_t tag[KUZ_MGM_TAG_SIZE];
+  kuz_mgm_t st;
+
+  kuz_mgm_init(&st, &ctx, modeNonce);
+  if(tables)
+  {
+    st.pclmul = 0;
+  }
+  if(encrypt)
+  {
+    kuz_mgm_encrypt(&st, buf, buf, bytes);
+    kuz_mgm_final(&st, tag, sizeof(tag));
+  }
+  else
+  {
+    // The tag does not match : the work is the same
+    kuz_mgm_decrypt(&st, buf, buf, bytes);
+    kuz_mgm_verify(&st, modeIv, sizeof(tag));
+  }
+}
+
+static void MgmEncrypt(uint8_t* buf, size_t bytes)
+{
+  Mgm(buf, bytes, 1, 0);
+}
+
+static void MgmDecrypt(uint8_t* buf, size_t bytes)
+{
+  Mgm(buf, bytes, 0, 0);
+}
+
+static void MgmTablesEncrypt(uint8_t* buf, size_t bytes)
+{
+  Mgm(buf, bytes, 1, 1);
+}
+
+static void MgmTablesDecrypt(uint8_t* buf, size_t bytes)
+{
+  Mgm(buf, bytes, 0, 1);
+}
+
+static void Omac(uint8_t* buf, size_t bytes)
+{
+  uint8_t mac[KUZ_BLOCK_SIZE];
+  kuz_omac_t st;
+
+  kuz_omac_init(&st, &macKey);
+  kuz_omac_update(&st, buf, bytes);
+  kuz_omac_final(&st, mac, sizeof(mac));
+}
+
+// KUZ_CTR_BATCH messages of bytes/KUZ_CTR_BATCH bytes
+static void OmacBatch(uint8_t* buf, size_t bytes)
+{
+  uint8_t macs[KUZ_CTR_BATCH*KUZ_BLOCK_SIZE];
+  const uint8_t* msg[KUZ_CTR_BATCH];
+  size_t len[KUZ_CTR_BATCH];
+  size_t i;
+
+  for(i=0;i<KUZ_CTR_BATCH;i++)
+  {
+    len[i] = bytes / KUZ_CTR_BATCH;
+    msg[i] = buf + i*len[i];
+  }
+  kuz_omac_batch(&macKey, msg, len, macs, KUZ_BLOCK_SIZE, KUZ_CTR_BATCH);
+}
+
+// The buffer as wrapped keys, one at a time. None matches its MAC, which
+// costs the same as a valid key.
+static void Kimp15(uint8_t* buf, size_t bytes)
+{
+  uint8_t iv[KUZ_KEXP_IV_SIZE];
+  uint8_t key[KUZ_KEY_SIZE];
+  size_t n = bytes / KUZ_KEXP_SIZE;
+  size_t i;
+
+  memset(iv, 0x5a, sizeof(iv));
+  for(i=0;i<n;i++)
+  {
+    kuz_kimp15(&macKey, &ctx, iv, buf + i*KUZ_KEXP_SIZE, key);
+  }
+}
+
+// The same, KUZ_CTR_BATCH keys at a time
+static void Kimp15Batch(uint8_t* buf, size_t bytes)
+{
+  uint8_t ivs[KUZ_CTR_BATCH*KUZ_KEXP_IV_SIZE];
+  uint8_t keys[KUZ_CTR_BATCH*KUZ_KEY_SIZE];
+  size_t n = bytes / KUZ_KEXP_SIZE;
+  size_t i, count;
+
+  memset(ivs, 0x5a, sizeof(ivs));
+  for(i=0;i<n;i+=count)
+  {
+    count = n - i < KUZ_CTR_BATCH ? n - i : KUZ_CTR_BATCH;
+    kuz_kimp15_batch(&macKey, &ctx, ivs, buf + i*KUZ_KEXP_SIZE, keys, count);
+  }
+}
+
+typedef struct
+{
+  const char* mode;
+  const char* op;
+  void (*run)(uint8_t* buf, size_t bytes);
+} bench_mode_t;
+
+static const bench_mode_t modes[] = {
+  { "ecb",          "encrypt", EcbEncrypt },
+  { "ecb",          "decrypt", EcbDecrypt },
+  { "ctr",          "xor",     CtrXor },
+  { "ctr-acpkm",    "xor",     AcpkmXor },
+  { "cbc",          "encrypt", CbcEncrypt },
+  { "cbc",          "decrypt", CbcDecrypt },
+  { "cfb",          "encrypt", CfbEncrypt },
+  { "cfb",          "decrypt", CfbDecrypt },
+  { "ofb",          "xor",     OfbXor },
+  { "mgm",          "encrypt", MgmEncrypt },
+  { "mgm",          "decrypt", MgmDecrypt },
+  { "mgm-tables",   "encrypt", MgmTablesEncrypt },
+  { "mgm-tables",   "decrypt", MgmTablesDecrypt },
+  { "omac",         "mac",     Omac },
+  { "omac-batch",   "mac",     OmacBatch },
+  { "kimp15",       "unwrap",  Kimp15 },
+  { "kimp15-batch", "unwrap",  Kimp15Batch },
+};
+
+#define HAVE_MODES 1
+#define MODE_COUNT (sizeof(modes) / sizeof(modes[0]))
+
+#endif // BENCH_BACKEND
+
+/*****************************************************************************/
+/* Timing                                                                    */
+/*****************************************************************************/
+
+static double Seconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+static uint64_t Cycles(void)
+{
+#if HAVE_TSC
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+static void PrintCycles(double cycles)
+{
+  if(HAVE_TSC)
+  {
+    printf("%.2f", cycles);
+  }
+  else
+  {
+    printf("null");
+  }
+}
+
+static int CheckVector(void)
+{
+  uint8_t b[BLOCK];
+
+  SetKey(testKey);
+  memcpy(b, testPt, BLOCK);
+  Encrypt(b, 1, 1);
+  if(memcmp(b, testCt, BLOCK) != 0)
+  {
+    return 0;
+  }
+  Decrypt(b, 1);
+  return memcmp(b, testPt, BLOCK) == 0;
+}
+
+static void KeySetup(double* cycles, double* ns)
+{
+  const unsigned n = 2000;
+  uint8_t key[32];
+  uint64_t c0;
+  double t0;
+  unsigned i;
+
+  memcpy(key, testKey, sizeof(key));
+  t0 = Seconds();
+  c0 = Cycles();
+  for(i=0;i<n;i++)
+  {
+    key[0] = (uint8_t)i;
+    SetKey(key);
+  }
+  *cycles = (double)(Cycles() - c0) / n;
+  *ns = (Seconds() - t0)*1e9 / n;
+}
+
+// Encrypt buf in place until minTime has passed, at least once
+static void Run(uint8_t* buf, size_t bytes, unsigned threads, double minTime, int first)
+{
+  uint64_t c0, c;
+  double t0, t;
+  size_t reps = 0;
+
+  Encrypt(buf, bytes / BLOCK, threads);  // warm up caches, pool and tables
+  t0 = Seconds();
+  c0 = Cycles();
+  do
+  {
+    Encrypt(buf, bytes / BLOCK, threads);
+    reps++;
+    t = Seconds() - t0;
+  } while(t < minTime);
+  c = Cycles() - c0;
+
+  printf("%s\n    {\"bytes\": %zu, \"threads\": %u, \"cycles_per_byte\": ", first ? "" : ",", bytes, threads);
+  PrintCycles((double)c / ((double)bytes*reps));
+  printf(", \"ns_per_byte\": %.3f, \"blocks_per_s\": %.0f}", t*1e9 / ((double)bytes*reps), (double)(bytes / BLOCK)*reps / t);
+  fflush(stdout);
+}
+
+#if HAVE_MODES
+
+// One mode over buf in place until minTime has passed, at least once
+static void RunMode(const bench_mode_t* m, uint8_t* buf, size_t bytes, double minTime, int first)
+{
+  uint64_t c0, c;
+  double t0, t;
+  size_t reps = 0;
+
+  m->run(buf, bytes);
+  t0 = Seconds();
+  c0 = Cycles();
+  do
+  {
+    m->run(buf, bytes);
+    reps++;
+    t = Seconds() - t0;
+  } while(t < minTime);
+  c = Cycles() - c0;
+
+  printf("%s\n    {\"mode\": \"%s\", \"op\": \"%s\", \"bytes\": %zu, \"cycles_per_byte\": ",
+         first ? "" : ",", m->mode, m->op, bytes);
+  PrintCycles((double)c / ((double)bytes*reps));
+  printf(", \"ns_per_byte\": %.3f, \"mb_per_s\": %.1f}", t*1e9 / ((double)bytes*reps), (double)bytes*reps / t / 1e6);
+  fflush(stdout);
+}
+
+#endif
+
+/*****************************************************************************/
+/* Main                                                                      */
+/*****************************************************************************/
+
+// Next point of a sweep : x factor, the last point being max itself
+static size_t NextStep(size_t v, size_t factor, size_t max)
+{
+  if(v >= max)
+  {
+    return max + 1;
+  }
+  return v*factor < max ? v*factor : max;
+}
+
+static size_t ParseSize(const char* s)
+{
+  char* end;
+  size_t v = strtoull(s, &end, 0);
+
+  switch(*end)
+  {
+    case 'G': case 'g': v <<= 10; // fall through
+    case 'M': case 'm': v <<= 10; // fall through
+    case 'K': case 'k': v <<= 10; break;
+    default: break;
+  }
+  return v;
+}
+
+int main(int argc, char** argv)
+{
+  size_t maxBytes = (size_t)1 << 30;
+  size_t modeBytes = (size_t)1 << 20;
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  unsigned maxThreads = cpus > 0 ? (unsigned)cpus : 1;
+  long footprint = -1;
+  double minTime = 0.1;
+  double setupCycles, setupNs;
+  uint8_t* buf;
+  size_t bytes;
+  unsigned threads;
+  int ok, first = 1, i;
+
+  for(i=1;i<argc;i++)
+  {
+    if(strcmp(argv[i], "--max") == 0 && i + 1 < argc)
+    {
+      maxBytes = ParseSize(argv[++i]);
+    }
+    else if(strcmp(argv[i], "--mode-bytes") == 0 && i + 1 < argc)
+    {
+      modeBytes = ParseSize(argv[++i]);
+    }
+    else if(strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+    {
+      maxThreads = (unsigned)atoi(argv[++i]);
+    }
+    else if(strcmp(argv[i], "--footprint") == 0 && i + 1 < argc)
+    {
+      footprint = atol(argv[++i]);
+    }
+    else if(strcmp(argv[i], "--min-time") == 0 && i + 1 < argc)
+    {
+      minTime = atof(argv[++i]);
+    }
+    else
+    {
+      fprintf(stderr, "usage: %s [--max BYTES[K|M|G]] [--mode-bytes BYTES[K|M|G]] [--threads N] [--footprint BYTES] [--min-time S]\n", argv[0]);
+      return 2;
+    }
+  }
+  if(maxThreads > MAX_THREADS)
+  {
+    maxThreads = MAX_THREADS;
+  }
+  if(maxThreads == 0)
+  {
+    maxThreads = 1;
+  }
+  // Whole blocks
+  maxBytes = maxBytes < BLOCK ? BLOCK : maxBytes / BLOCK * BLOCK;
+  modeBytes = modeBytes > maxBytes ? maxBytes : modeBytes < BLOCK ? BLOCK : modeBytes / BLOCK * BLOCK;
+
+  ok = CheckVector();
+  printf("{\"backend\": \"%s\", \"engine\": \"%s\", \"vector_ok\": %s, \"table_bytes\": ",
+         BACKEND_NAME, Engine(), ok ? "true" : "false");
+  if(footprint >= 0)
+  {
+    printf("%ld", footprint);
+  }
+  else
+  {
+    printf("null");
+  }
+  if(!ok)
+  {
+    printf(", \"runs\": [], \"modes\": []}\n");
+    fprintf(stderr, "%s: standard test vector FAILED\n", BACKEND_NAME);
+    return 1;
+  }
+
+  KeySetup(&setupCycles, &setupNs);
+  SetKey(testKey);
+  printf(", \"key_setup_cycles\": ");
+  PrintCycles(setupCycles);
+  printf(", \"key_setup_ns\": %.1f,\n  \"runs\": [", setupNs);
+
+  buf = (uint8_t*)malloc(maxBytes < BLOCK ? BLOCK : maxBytes);
+  if(buf == NULL)
+  {
+    fprintf(stderr, "%s: cannot allocate %zu bytes\n", BACKEND_NAME, maxBytes);
+    return 2;
+  }
+  memset(buf, 0x5a, maxBytes);
+
+  for(threads = 1; threads <= maxThreads; threads = (unsigned)NextStep(threads, 2, maxThreads))
+  {
+    for(bytes = BLOCK; bytes <= maxBytes; bytes = NextStep(bytes, 4, maxBytes))
+    {
+      Run(buf, bytes, threads, minTime, first);
+      first = 0;
+    }
+  }
+  printf("\n  ],\n  \"modes\": [");
+
+#if HAVE_MODES
+  kuz_omac_key_init(&macKey, &ctx);
+  for(i=0;i<(int)MODE_COUNT;i++)
+  {
+    RunMode(&modes[i], buf, modeBytes, minTime, i == 0);
+  }
+#endif
+  printf("\n  ]}\n");
+
+  free(buf);
+  return 0;
+}
@@ -0,0 +1,591 @@
+/* Simulated power traces of the Kuznyechik firmware, computed on the host. */
+
+/*
+
+The makefile builds the firmware cipher natively with KUZNYECHIK_LEAKAGE,
+LEAK_TARGET selecting which one :
+
+  ref     kuznyechik.c, kuz_encrypt (what simpleserial-kuznyechik runs)
+  masked  kuznyechik_masked.c, masked_kuznyechik_crypto
+
+Every state store of the cipher (KUZ_LEAK_STORE : AddRoundKey, S step,
+R step, and the mask updates of the masked code) calls kuz_leak(before,
+after), which appends one sample to the trace of the calling thread. A trace
+is one encryption, the firmware's trigger window :
+
+  sample = model(before, after) + N(0, noise^2)
+
+  hw        HW(after)                                   (default)
+  hd        HW(before ^ after)
+  weighted  sum of w[b] * bit b of after                --weights w0,...,w7
+
+and two kinds of desynchronisation, drawn for every trace :
+
+  --jitter P     after each store, an idle sample (0 + noise) with probability P
+  --misalign M   the trace shifted by -M..M samples, idle samples at the edges
+
+--offset and --samples cut the window out of the stores of one encryption
+(2608 for ref, 4944 for masked; all of them by default).
+
+Output, written by every worker straight into place (pwrite) :
+
+  --out     traces.npy         float32, N x samples (numpy .npy)
+  --pairs   clair_chiffre.txt  "<pt> <ct>" lines of Multiple_acquisitions.py
+
+Plaintexts, masks, noise and jitter only depend on --seed and on the trace
+number : the files are the same whatever --threads.
+
+The standard test vector is checked first; the exit status is 1 if the
+instrumented cipher gets it wrong.
+
+*/
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#define LEAK_REF    1
+#define LEAK_MASKED 2
+
+#if LEAK_TARGET == LEAK_MASKED
+#include "kuznyechik_masked.h"
+#else
+#include "kuznyechik.h"
+#endif
+#include "kuznyechik_leak.h"
+
+#define BLOCK      16
+#define KEY        32
+#define MAX_STORES 8192   // per encryption, masked : 4944
+#define CHUNK      256    // traces per pwrite
+#define PAIR_LINE  66     // "%032x %032x\n"
+
+static const uint8_t testKey[KEY] = {
+  0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+  0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10, 0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef };
+static const uint8_t testPt[BLOCK] = {
+  0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x00, 0xff, 0xee, 0xdd, 0xcc, 0xbb, 0xaa, 0x99, 0x88 };
+static const uint8_t testCt[BLOCK] = {
+  0x7f, 0x67, 0x9d, 0x90, 0xbe, 0xbc, 0x24, 0x30, 0x5a, 0x46, 0x8d, 0x42, 0xb9, 0xd4, 0xed, 0xcd };
+
+/*****************************************************************************/
+/* Target                                                                    */
+/*****************************************************************************/
+
+#if LEAK_TARGET == LEAK_MASKED
+
+#define TARGET_NAME "masked"
+
+// kuznyechik_masked.c keeps a pointer to the key; its round keys are shared,
+// set once before the workers start
+static uint8_t maskedKey[KEY];
+
+static void SetKey(const uint8_t* key)
+{
+  memcpy(maskedKey, key, KEY);
+  kuznyechik_setkey(maskedKey);
+}
+
+static void Encrypt(uint8_t* block)
+{
+  masked_kuznyechik_crypto(block);
+}
+
+// KUZ_RAND()/KUZ_SRAND() of the masked code : glibc's generator, one per thread
+static __thread struct random_data randData;
+static __thread char randState[128];
+
+void kuz_leak_srand(unsigned int seed)
+{
+  memset(&randData, 0, sizeof(randData));
+  initstate_r(seed, randState, sizeof(randState), &randData);
+}
+
+int kuz_leak_rand(void)
+{
+  int32_t r;
+  random_r(&randData, &r);
+  return r;
+}
+
+#else
+
+#define TARGET_NAME "ref"
+
+static kuz_ctx_t ctx;
+
+static void SetKey(const uint8_t* key)
+{
+  kuz_ctx_init(&ctx, key);
+}
+
+static void Encrypt(uint8_t* block)
+{
+  kuz_encrypt(&ctx, block, block);
+}
+
+#endif // LEAK_TARGET
+
+/*****************************************************************************/
+/* Leakage model                                                             */
+/*****************************************************************************/
+
+typedef struct
+{
+  float*  leak;   // model value of every store of the encryption
+  size_t  n;
+  size_t  cap;
+} Recorder;
+
+static float Model[256];  // model of a byte : after, or before ^ after (hd)
+static int   ModelHd;
+
+// The trace being recorded by this thread, NULL outside of an encryption
+static __thread Recorder* recorder;
+
+void kuz_leak(uint8_t before, uint8_t after)
+{
+  Recorder* r = recorder;
+
+  if(r != NULL && r->n < r->cap)
+  {
+    r->leak[r->n++] = Model[ModelHd ? before ^ after : after];
+  }
+}
+
+static void InitModel(const char* model, const float* weights)
+{
+  unsigned v, b;
+
+  ModelHd = strcmp(model, "hd") == 0;
+  for(v=0;v<256;v++)
+  {
+    Model[v] = 0;
+    for(b=0;b<8;b++)
+    {
+      if((v >> b) & 1)
+      {
+        Model[v] += strcmp(model, "weighted") == 0 ? weights[b] : 1.0f;
+      }
+    }
+  }
+}
+
+/*****************************************************************************/
+/* Random numbers                                                            */
+/*****************************************************************************/
+
+// xoshiro256**, seeded by splitmix64 from (seed, trace number)
+typedef struct
+{
+  uint64_t s[4];
+  int      haveSpare;
+  float    spare;
+} Rng;
+
+static uint64_t SplitMix(uint64_t* x)
+{
+  uint64_t z = (*x += 0x9e3779b97f4a7c15ULL);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+static void RngSeed(Rng* rng, uint64_t seed, uint64_t trace)
+{
+  uint64_t x = seed ^ (trace * 0xd1342543de82ef95ULL);
+  int i;
+
+  for(i=0;i<4;i++)
+  {
+    rng->s[i] = SplitMix(&x);
+  }
+  rng->haveSpare = 0;
+}
+
+static uint64_t RngNext(Rng* rng)
+{
+  uint64_t* s = rng->s;
+  uint64_t r = s[1] * 5;
+  uint64_t t = s[1] << 17;
+
+  r = ((r << 7) | (r >> 57)) * 9;
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = (s[3] << 45) | (s[3] >> 19);
+  return r;
+}
+
+// Uniform in (0, 1]
+static double RngUniform(Rng* rng)
+{
+  return ((RngNext(rng) >> 11) + 1) * (1.0 / 9007199254740992.0);
+}
+
+// N(0, 1), Box-Muller, two at a time
+static float RngGauss(Rng* rng)
+{
+  double r, a;
+
+  if(rng->haveSpare)
+  {
+    rng->haveSpare = 0;
+    return rng->spare;
+  }
+  r = sqrt(-2.0*log(RngUniform(rng)));
+  a = 2.0*M_PI*RngUniform(rng);
+  rng->spare = (float)(r*sin(a));
+  rng->haveSpare = 1;
+  return (float)(r*cos(a));
+}
+
+/*****************************************************************************/
+/* Traces                                                                    */
+/*****************************************************************************/
+
+typedef struct
+{
+  uint64_t traces;
+  size_t   samples;
+  size_t   offset;
+  double   noise;
+  double   jitter;
+  unsigned misalign;
+  uint64_t seed;
+  int      fdTraces;
+  int      fdPairs;
+  off_t    dataStart;  // after the .npy header
+  uint64_t next;       // next chunk, shared by the workers
+} Job;
+
+// One encryption of a random plaintext : its samples and its pt/ct line
+static void Trace(const Job* job, Recorder* rec, uint64_t t, float* out, char* pair)
+{
+  uint8_t pt[BLOCK], ct[BLOCK];
+  uint64_t jitter = job->jitter >= 1.0 ? UINT64_MAX : (uint64_t)(job->jitter * 18446744073709551616.0);
+  int64_t k, shift = 0;
+  size_t i;
+  Rng rng;
+
+  RngSeed(&rng, job->seed, t);
+  for(i=0;i<BLOCK;i++)
+  {
+    pt[i] = (uint8_t)RngNext(&rng);
+  }
+  memcpy(ct, pt, BLOCK);
+  rec->n = 0;
+  recorder = rec;
+  Encrypt(ct);
+  recorder = NULL;
+
+  if(job->misalign > 0)
+  {
+    shift = (int64_t)(RngNext(&rng) % (2*job->misalign + 1)) - job->misalign;
+  }
+
+  // Stores in order, idle samples after some of them (jitter), the whole
+  // stream shifted : out[k] = stream[k + offset - shift]
+  memset(out, 0, job->samples*sizeof(float));
+  k = shift - (int64_t)job->offset;
+  for(i=0;i<rec->n && k<(int64_t)job->samples;i++)
+  {
+    if(k >= 0)
+    {
+      out[k] = rec->leak[i];
+    }
+    k++;
+    if(jitter != 0 && RngNext(&rng) < jitter)
+    {
+      k++;
+    }
+  }
+  if(job->noise > 0)
+  {
+    for(i=0;i<job->samples;i++)
+    {
+      out[i] += (float)job->noise * RngGauss(&rng);
+    }
+  }
+
+  for(i=0;i<BLOCK;i++)
+  {
+    sprintf(pair + 2*i, "%02x", pt[i]);
+    sprintf(pair + 33 + 2*i, "%02x", ct[i]);
+  }
+  pair[32] = ' ';
+  pair[PAIR_LINE-1] = '\n';
+}
+
+static int WriteAt(int fd, const void* buf, size_t len, off_t at)
+{
+  const char* p = (const char*)buf;
+  ssize_t w;
+
+  while(len > 0)
+  {
+    w = pwrite(fd, p, len, at);
+    if(w <= 0)
+    {
+      return -1;
+    }
+    p += w;
+    len -= (size_t)w;
+    at += w;
+  }
+  return 0;
+}
+
+static void* Worker(void* arg)
+{
+  Job* job = (Job*)arg;
+  uint64_t chunks = (job->traces + CHUNK - 1) / CHUNK;
+  uint64_t c, t, first, n;
+  Recorder rec;
+  float* samples;
+  char* pairs;
+
+  rec.cap = MAX_STORES;
+  rec.leak = (float*)malloc(MAX_STORES*sizeof(float));
+  samples = (float*)malloc((size_t)CHUNK*job->samples*sizeof(float));
+  pairs = (char*)malloc((size_t)CHUNK*PAIR_LINE + 1);
+  if(rec.leak == NULL || samples == NULL || pairs == NULL)
+  {
+    fprintf(stderr, "kuznyechik_leakage: out of memory\n");
+    exit(2);
+  }
+
+  while((c = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED)) < chunks)
+  {
+    first = c*CHUNK;
+    n = job->traces - first < CHUNK ? job->traces - first : CHUNK;
+    for(t=0;t<n;t++)
+    {
+      Trace(job, &rec, first + t, samples + t*job->samples, pairs + t*PAIR_LINE);
+    }
+    if(WriteAt(job->fdTraces, samples, n*job->samples*sizeof(float),
+               job->dataStart + (off_t)(first*job->samples*sizeof(float))) != 0
+       || WriteAt(job->fdPairs, pairs, n*PAIR_LINE, (off_t)(first*PAIR_LINE)) != 0)
+    {
+      perror("kuznyechik_leakage: write");
+      exit(2);
+    }
+  }
+  free(rec.leak);
+  free(samples);
+  free(pairs);
+  return NULL;
+}
+
+/*****************************************************************************/
+/* Main                                                                      */
+/*****************************************************************************/
+
+// .npy version 1.0 header of a C-order float32 N x S array, 64-byte aligned
+static size_t NpyHeader(char* buf, uint64_t rows, size_t cols)
+{
+  int len = snprintf(buf + 10, 118, "{'descr': '<f4', 'fortran_order': False, 'shape': (%llu, %zu), }",
+                     (unsigned long long)rows, cols);
+  size_t total = (10 + (size_t)len + 1 + 63) & ~(size_t)63;
+
+  memcpy(buf, "\x93NUMPY\x01\x00", 8);
+  buf[8] = (char)((total - 10) & 0xff);
+  buf[9] = (char)((total - 10) >> 8);
+  memset(buf + 10 + len, ' ', total - 10 - (size_t)len - 1);
+  buf[total - 1] = '\n';
+  return total;
+}
+
+static int ParseHex(const char* s, uint8_t* out, size_t len)
+{
+  size_t i;
+  unsigned v;
+
+  if(strlen(s) != 2*len)
+  {
+    return -1;
+  }
+  for(i=0;i<len;i++)
+  {
+    if(sscanf(s + 2*i, "%2x", &v) != 1)
+    {
+      return -1;
+    }
+    out[i] = (uint8_t)v;
+  }
+  return 0;
+}
+
+static int ParseWeights(const char* s, float* w)
+{
+  char* end;
+  int b;
+
+  for(b=0;b<8;b++)
+  {
+    w[b] = strtof(s, &end);
+    if(end == s || (b < 7 && *end != ','))
+    {
+      return -1;
+    }
+    s = end + 1;
+  }
+  return *end == '\0' ? 0 : -1;
+}
+
+// Stores per encryption, 0 if the standard test vector is wrong
+static size_t CheckVector(void)
+{
+  uint8_t b[BLOCK];
+  Recorder rec;
+  float leak[MAX_STORES];
+
+  rec.leak = leak;
+  rec.cap = MAX_STORES;
+  rec.n = 0;
+  SetKey(testKey);
+  memcpy(b, testPt, BLOCK);
+  recorder = &rec;
+  Encrypt(b);
+  recorder = NULL;
+  return memcmp(b, testCt, BLOCK) == 0 ? rec.n : 0;
+}
+
+static double Seconds(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+static void Usage(const char* name)
+{
+  fprintf(stderr, "usage: %s [--traces N] [--threads N] [--model hw|hd|weighted] [--weights w0,...,w7]\n"
+                  "       [--noise SIGMA] [--jitter P] [--misalign M] [--offset O] [--samples S]\n"
+                  "       [--key HEX64] [--seed S] [--out traces.npy] [--pairs clair_chiffre.txt]\n", name);
+}
+
+int main(int argc, char** argv)
+{
+  const char* model = "hw";
+  const char* outName = "traces.npy";
+  const char* pairsName = "clair_chiffre.txt";
+  float weights[8] = { 1, 1, 1, 1, 1, 1, 1, 1 };
+  uint8_t key[KEY];
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  unsigned threads = cpus > 0 ? (unsigned)cpus : 1;
+  size_t stores, samples = 0, headerLen;
+  char header[128];
+  pthread_t* tids;
+  double t0;
+  Job job;
+  unsigned i;
+  int a;
+
+  memcpy(key, testKey, KEY);
+  memset(&job, 0, sizeof(job));
+  job.traces = 10000;
+  job.seed = 1;
+
+  for(a=1;a<argc;a++)
+  {
+    const char* v = a + 1 < argc ? argv[a + 1] : NULL;
+
+    if(v == NULL)
+    {
+      Usage(argv[0]);
+      return 2;
+    }
+    if(strcmp(argv[a], "--traces") == 0)         job.traces = strtoull(v, NULL, 0);
+    else if(strcmp(argv[a], "--threads") == 0)   threads = (unsigned)atoi(v);
+    else if(strcmp(argv[a], "--model") == 0)     model = v;
+    else if(strcmp(argv[a], "--noise") == 0)     job.noise = atof(v);
+    else if(strcmp(argv[a], "--jitter") == 0)    job.jitter = atof(v);
+    else if(strcmp(argv[a], "--misalign") == 0)  job.misalign = (unsigned)atoi(v);
+    else if(strcmp(argv[a], "--offset") == 0)    job.offset = strtoull(v, NULL, 0);
+    else if(strcmp(argv[a], "--samples") == 0)   samples = strtoull(v, NULL, 0);
+    else if(strcmp(argv[a], "--seed") == 0)      job.seed = strtoull(v, NULL, 0);
+    else if(strcmp(argv[a], "--out") == 0)       outName = v;
+    else if(strcmp(argv[a], "--pairs") == 0)     pairsName = v;
+    else if(strcmp(argv[a], "--weights") == 0 && ParseWeights(v, weights) == 0) {}
+    else if(strcmp(argv[a], "--key") == 0 && ParseHex(v, key, KEY) == 0) {}
+    else
+    {
+      Usage(argv[0]);
+      return 2;
+    }
+    a++;
+  }
+  if(strcmp(model, "hw") != 0 && strcmp(model, "hd") != 0 && strcmp(model, "weighted") != 0)
+  {
+    Usage(argv[0]);
+    return 2;
+  }
+  if(threads == 0)
+  {
+    threads = 1;
+  }
+
+  InitModel(model, weights);
+  stores = CheckVector();
+  if(stores == 0)
+  {
+    fprintf(stderr, "%s: standard test vector FAILED\n", TARGET_NAME);
+    return 1;
+  }
+  if(job.offset >= stores)
+  {
+    fprintf(stderr, "kuznyechik_leakage: --offset past the %zu stores of an encryption\n", stores);
+    return 2;
+  }
+  job.samples = samples != 0 ? samples : stores - job.offset;
+  SetKey(key);
+
+  job.fdTraces = open(outName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  job.fdPairs = open(pairsName, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if(job.fdTraces < 0 || job.fdPairs < 0)
+  {
+    perror("kuznyechik_leakage: open");
+    return 2;
+  }
+  headerLen = NpyHeader(header, job.traces, job.samples);
+  job.dataStart = (off_t)headerLen;
+  if(WriteAt(job.fdTraces, header, headerLen, 0) != 0
+     || ftruncate(job.fdTraces, job.dataStart + (off_t)(job.traces*job.samples*sizeof(float))) != 0
+     || ftruncate(job.fdPairs, (off_t)(job.traces*PAIR_LINE)) != 0)
+  {
+    perror("kuznyechik_leakage: write");
+    return 2;
+  }
+
+  t0 = Seconds();
+  tids = (pthread_t*)malloc(threads*sizeof(pthread_t));
+  for(i=0;i<threads;i++)
+  {
+    if(pthread_create(&tids[i], NULL, Worker, &job) != 0)
+    {
+      fprintf(stderr, "kuznyechik_leakage: cannot start thread %u\n", i);
+      return 2;
+    }
+  }
+  for(i=0;i<threads;i++)
+  {
+    pthread_join(tids[i], NULL);
+  }
+  free(tids);
+  close(job.fdTraces);
+  close(job.fdPairs);
+
+  fprintf(stderr, "%s: %llu traces x %zu samples (%zu stores per encryption, model %s), %u threads, %.2f s\n",
+          TARGET_NAME, (unsigned long long)job.traces, job.samples, stores, model, threads, Seconds() - t0);
+  return 0;
+}
@@ -0,0 +1,448 @@
+/* Known-answer tests of the Kuznyechik engines and modes, on the host. */
+
+/*
+
+The makefile builds this file once per engine (ref, ls, simd, bitslice64,
+bitslice256) with KUZNYECHIK_MODES, and make runs them all, simd once per
+x86 kernel (KUZ_X86_KERNEL) : make fails if one vector is missed. Key
+8899..77 fedc..ef of the standard everywhere.
+
+  ecb            GOST R 34.12-2015 A.2, GOST R 34.13-2015 A.1.1
+  ctr            GOST R 34.13-2015 A.1.2
+  ofb, cbc, cfb  GOST R 34.13-2015 A.1.3 - A.1.5 (z = 2), both ways
+  mac            GOST R 34.13-2015 A.1.6, 64-bit MAC
+  acpkm          R 1323565.1.017-2018, CTR-ACPKM with N = 256 bits
+  kexp15         R 1323565.1.017-2018 key wrap : the example of the standard,
+                 round trip, a wrong MAC rejected, kuz_kimp15_batch equal to
+                 kuz_kimp15
+  mgm            R 1323565.1.026-2019 A.1, encryption, tag and decryption
+
+Every mode is also run over its message split in pieces (1 to 17 bytes,
+whole blocks for CBC, CFB and OFB), which must give the same output as one
+call. One "ok" / "FAIL" line per
+test; the exit status is 1 if any failed.
+
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "kuznyechik.h"
+#include "kuznyechik_modes.h"
+#ifdef KUZNYECHIK_SIMD
+#include <stdlib.h>
+#include "kuznyechik_internal.h"
+#endif
+
+#if defined(KUZNYECHIK_BITSLICE_ENGINE)
+#define ENGINE_NAME "bitslice" KUZ_STR(KUZNYECHIK_BITSLICE_WIDTH)
+#elif defined(KUZNYECHIK_SIMD)
+#define ENGINE_NAME "simd"
+#elif defined(KUZNYECHIK_LS_TABLES)
+#define ENGINE_NAME "ls"
+#else
+#define ENGINE_NAME "ref"
+#endif
+
+#define KUZ_XSTR(x) #x
+#define KUZ_STR(x) KUZ_XSTR(x)
+
+#define MAX_MSG 128
+#define ECB_BLOCKS 71
+
+static const char* testKey = "8899aabbccddeeff0011223344556677fedcba98765432100123456789abcdef";
+
+// P1..P4 of GOST R 34.13-2015, then P5..P7 of R 1323565.1.017-2018
+static const char* testPt =
+  "1122334455667700ffeeddccbbaa9988" "00112233445566778899aabbcceeff0a"
+  "112233445566778899aabbcceeff0a00" "2233445566778899aabbcceeff0a0011"
+  "33445566778899aabbcceeff0a001122" "445566778899aabbcceeff0a00112233"
+  "5566778899aabbcceeff0a0011223344";
+
+static const char* ctrIv = "1234567890abcef0";
+static const char* feedbackIv = "1234567890abcef0a1b2c3d4e5f0011223344556677889901213141516171819";
+
+static int failed = 0;
+static char engine[32] = ENGINE_NAME;
+
+/*****************************************************************************/
+/* Helpers                                                                   */
+/*****************************************************************************/
+
+static size_t Hex(const char* s, uint8_t* out)
+{
+  size_t n = 0;
+  unsigned v;
+
+  while(s[2*n] != '\0' && sscanf(s + 2*n, "%2x", &v) == 1)
+  {
+    out[n++] = (uint8_t)v;
+  }
+  return n;
+}
+
+static void Report(const char* test, int ok)
+{
+  printf("%s: %-8s %s\n", engine, test, ok ? "ok" : "FAIL");
+  if(!ok)
+  {
+    failed = 1;
+  }
+}
+
+// got against the first len bytes of want
+static int Equal(const uint8_t* got, const char* want, size_t len)
+{
+  uint8_t w[MAX_MSG];
+  return Hex(want, w) >= len && memcmp(got, w, len) == 0;
+}
+
+/*****************************************************************************/
+/* GOST R 34.13-2015                                                         */
+/*****************************************************************************/
+
+static void TestEcb(const kuz_ctx_t* ctx, const uint8_t* pt)
+{
+  static const char* ct =
+    "7f679d90bebc24305a468d42b9d4edcd" "b429912c6e0032f9285452d76718d08b"
+    "f0ca33549d247ceef3f5a5313bd4b157" "d0b09ccde830b9eb3a02c4c5aa8ada98";
+  uint8_t buf[ECB_BLOCKS*KUZ_BLOCK_SIZE], one[KUZ_BLOCK_SIZE];
+  size_t i;
+  int ok;
+
+  kuz_encrypt(ctx, pt, one);
+  ok = Equal(one, ct, KUZ_BLOCK_SIZE);
+  kuz_decrypt(ctx, one, one);
+  ok &= memcmp(one, pt, KUZ_BLOCK_SIZE) == 0;
+
+  // P1..P4 over and over : full groups of the SIMD kernels, then a tail
+  for(i=0;i<ECB_BLOCKS;i++)
+  {
+    memcpy(buf + i*KUZ_BLOCK_SIZE, pt + (i & 3)*KUZ_BLOCK_SIZE, KUZ_BLOCK_SIZE);
+  }
+  kuz_encrypt_blocks(ctx, buf, buf, ECB_BLOCKS);
+  for(i=0;i<ECB_BLOCKS;i++)
+  {
+    ok &= Equal(buf + i*KUZ_BLOCK_SIZE, ct + (i & 3)*2*KUZ_BLOCK_SIZE, KUZ_BLOCK_SIZE);
+  }
+  kuz_decrypt_blocks(ctx, buf, buf, ECB_BLOCKS);
+  for(i=0;i<ECB_BLOCKS;i++)
+  {
+    ok &= memcmp(buf + i*KUZ_BLOCK_SIZE, pt + (i & 3)*KUZ_BLOCK_SIZE, KUZ_BLOCK_SIZE) == 0;
+  }
+  Report("ecb", ok);
+}
+
+static void TestCtr(const kuz_ctx_t* ctx, const uint8_t* pt)
+{
+  static const char* ct =
+    "f195d8bec10ed1dbd57b5fa240bda1b8" "85eee733f6a13e5df33ce4b33c45dee4"
+    "a5eae88be6356ed3d5e877f13564a3a5" "cb91fab1f20cbab6d1c6d15820bdba73";
+  uint8_t iv[KUZ_CTR_IV_SIZE], buf[4*KUZ_BLOCK_SIZE];
+  int ok;
+
+  Hex(ctrIv, iv);
+  kuz_ctr_xor(ctx, iv, pt, buf, sizeof(buf));
+  ok = Equal(buf, ct, sizeof(buf));
+  // blocks 2..3 alone, then a truncated block
+  kuz_ctr_xor_from(ctx, iv, 2, pt + 2*KUZ_BLOCK_SIZE, buf, 2*KUZ_BLOCK_SIZE);
+  ok &= Equal(buf, ct + 4*KUZ_BLOCK_SIZE, 2*KUZ_BLOCK_SIZE);
+  kuz_ctr_xor(ctx, iv, pt, buf, 5);
+  ok &= Equal(buf, ct, 5);
+  Report("ctr", ok);
+}
+
+typedef int (*feedback_f)(const kuz_ctx_t*, uint8_t*, size_t, const uint8_t*, uint8_t*, size_t);
+
+// One call, then the same message in pieces of 1 to 4 blocks (a truncated
+// block ends a CFB / OFB message), then all but the last 5 bytes
+static int Feedback(const kuz_ctx_t* ctx, feedback_f f, int cbc, const uint8_t* in, const char* want,
+                    size_t len)
+{
+  uint8_t iv[2*KUZ_BLOCK_SIZE], out[4*KUZ_BLOCK_SIZE];
+  size_t piece, done, n;
+  int ok;
+
+  Hex(feedbackIv, iv);
+  ok = f(ctx, iv, sizeof(iv), in, out, cbc ? len / KUZ_BLOCK_SIZE : len) == 0 && Equal(out, want, len);
+  for(piece=1;piece<=4;piece++)
+  {
+    Hex(feedbackIv, iv);
+    memset(out, 0, sizeof(out));
+    for(done=0;done<len;done+=n)
+    {
+      n = len - done < piece*KUZ_BLOCK_SIZE ? len - done : piece*KUZ_BLOCK_SIZE;
+      f(ctx, iv, sizeof(iv), in + done, out + done, cbc ? n / KUZ_BLOCK_SIZE : n);
+    }
+    ok &= Equal(out, want, len);
+  }
+  if(!cbc)
+  {
+    Hex(feedbackIv, iv);
+    memset(out, 0, sizeof(out));
+    f(ctx, iv, sizeof(iv), in, out, len - 5);
+    ok &= Equal(out, want, len - 5);
+  }
+  return ok;
+}
+
+static void TestFeedback(const kuz_ctx_t* ctx, const uint8_t* pt)
+{
+  static const char* ofb =
+    "81800a59b1842b24ff1f795e897abd95" "ed5b47a7048cfab48fb521369d9326bf"
+    "66a257ac3ca0b8b1c80fe7fc10288a13" "203ebbc066138660a0292243f6903150";
+  static const char* cbc =
+    "689972d4a085fa4d90e52e3d6d7dcc27" "2826e661b478eca6af1e8e448d5ea5ac"
+    "fe7babf1e91999e85640e8b0f49d90d0" "167688065a895c631a2d9a1560b63970";
+  static const char* cfb =
+    "81800a59b1842b24ff1f795e897abd95" "ed5b47a7048cfab48fb521369d9326bf"
+    "79f2a8eb5cc68d38842d264e97a238b5" "4ffebecd4e922de6c75bd9dd44fbf4d1";
+  const size_t len = 4*KUZ_BLOCK_SIZE;
+  uint8_t ct[4*KUZ_BLOCK_SIZE];
+  char p[2*4*KUZ_BLOCK_SIZE + 1];
+  size_t i;
+
+  for(i=0;i<len;i++)
+  {
+    snprintf(p + 2*i, 3, "%02x", pt[i]);
+  }
+
+  Hex(ofb, ct);
+  Report("ofb", Feedback(ctx, kuz_ofb_xor, 0, pt, ofb, len)
+              && Feedback(ctx, kuz_ofb_xor, 0, ct, p, len));
+  Hex(cbc, ct);
+  Report("cbc", Feedback(ctx, kuz_cbc_encrypt, 1, pt, cbc, len)
+              && Feedback(ctx, kuz_cbc_decrypt, 1, ct, p, len));
+  Hex(cfb, ct);
+  Report("cfb", Feedback(ctx, kuz_cfb_encrypt, 0, pt, cfb, len)
+              && Feedback(ctx, kuz_cfb_decrypt, 0, ct, p, len));
+}
+
+static void TestMac(const kuz_ctx_t* ctx, const uint8_t* pt)
+{
+  static const char* mac = "336f4d296059fbe3";
+  const uint8_t* msg[3] = { pt, pt, pt };
+  const size_t len[3] = { 4*KUZ_BLOCK_SIZE, 4*KUZ_BLOCK_SIZE, 4*KUZ_BLOCK_SIZE };
+  kuz_omac_key_t key;
+  kuz_omac_t st;
+  uint8_t out[8], macs[3*8];
+  size_t piece, done, n;
+  int ok, i;
+
+  kuz_omac_key_init(&key, ctx);
+  kuz_omac_init(&st, &key);
+  kuz_omac_update(&st, pt, 4*KUZ_BLOCK_SIZE);
+  kuz_omac_final(&st, out, sizeof(out));
+  ok = Equal(out, mac, sizeof(out));
+
+  for(piece=1;piece<=17;piece++)
+  {
+    kuz_omac_init(&st, &key);
+    for(done=0;done<4*KUZ_BLOCK_SIZE;done+=n)
+    {
+      n = 4*KUZ_BLOCK_SIZE - done < piece ? 4*KUZ_BLOCK_SIZE - done : piece;
+      kuz_omac_update(&st, pt + done, n);
+    }
+    kuz_omac_final(&st, out, sizeof(out));
+    ok &= Equal(out, mac, sizeof(out));
+  }
+
+  kuz_omac_batch(&key, msg, len, macs, 8, 3);
+  for(i=0;i<3;i++)
+  {
+    ok &= Equal(macs + 8*i, mac, 8);
+  }
+  Report("mac", ok);
+}
+
+/*****************************************************************************/
+/* R 1323565.1.017-2018                                                      */
+/*****************************************************************************/
+
+static void TestAcpkm(const kuz_ctx_t* ctx, const uint8_t* pt)
+{
+  static const char* ct =
+    "f195d8bec10ed1dbd57b5fa240bda1b8" "85eee733f6a13e5df33ce4b33c45dee4"
+    "4bceeb8f646f4c55001706275e85e800" "587c4df568d094393e4834afd0805046"
+    "cf30f57686aeece11cfc6c316b8a896e" "dffd07ec813636460c4f3b743423163e"
+    "6409a9c282fac8d469d221e7fbd6de5d";
+  const size_t len = 7*KUZ_BLOCK_SIZE;
+  kuz_acpkm_t st;
+  uint8_t iv[KUZ_CTR_IV_SIZE], buf[7*KUZ_BLOCK_SIZE];
+  size_t piece, done, n;
+  int ok;
+
+  Hex(ctrIv, iv);
+  ok = kuz_acpkm_init(&st, ctx, iv, 2*KUZ_BLOCK_SIZE) == 0;
+  kuz_acpkm_xor(&st, pt, buf, len);
+  ok &= Equal(buf, ct, len);
+
+  for(piece=1;piece<=17;piece++)
+  {
+    kuz_acpkm_init(&st, ctx, iv, 2*KUZ_BLOCK_SIZE);
+    for(done=0;done<len;done+=n)
+    {
+      n = len - done < piece ? len - done : piece;
+      kuz_acpkm_xor(&st, pt + done, buf + done, n);
+    }
+    ok &= Equal(buf, ct, len);
+  }
+  ok &= kuz_acpkm_init(&st, ctx, iv, KUZ_BLOCK_SIZE + 1) == -1;
+
+  kuz_acpkm_wipe(&st);
+  for(done=0;done<sizeof(st);done++)
+  {
+    ok &= ((const uint8_t*)&st)[done] == 0;
+  }
+  Report("acpkm", ok);
+}
+
+static void TestKexp(void)
+{
+  static const char* iv = "0909472dd9f26be8";
+  static const char* kexp =
+    "e36184e84e8d736ff36cc2e5ae065dc656b23c20f549b02fdff88e1f3f30d8c2"
+    "9a53f3ca554dbad80de152b9a4625b32";
+  uint8_t macKey[KUZ_KEY_SIZE], encKey[KUZ_KEY_SIZE], key[KUZ_KEY_SIZE], out[KUZ_KEY_SIZE];
+  uint8_t ivs[3*KUZ_KEXP_IV_SIZE], wrapped[3*KUZ_KEXP_SIZE], keys[3*KUZ_KEY_SIZE];
+  kuz_ctx_t mac, enc;
+  kuz_omac_key_t omac;
+  int ok, i;
+
+  Hex("08090a0b0c0d0e0f0001020304050607101112131415161718191a1b1c1d1e1f", macKey);
+  Hex("202122232425262728292a2b2c2d2e2f38393a3b3c3d3e3f3031323334353637", encKey);
+  Hex(testKey, key);
+  kuz_ctx_init(&mac, macKey);
+  kuz_ctx_init(&enc, encKey);
+  kuz_omac_key_init(&omac, &mac);
+
+  // The example of the standard, wrapped and unwrapped
+  Hex(iv, ivs);
+  kuz_kexp15(&omac, &enc, ivs, key, wrapped);
+  ok = Equal(wrapped, kexp, KUZ_KEXP_SIZE);
+  ok &= kuz_kimp15(&omac, &enc, ivs, wrapped, out) == 0 && memcmp(out, key, KUZ_KEY_SIZE) == 0;
+
+  for(i=0;i<3;i++)
+  {
+    memset(ivs + i*KUZ_KEXP_IV_SIZE, 0x09 + i, KUZ_KEXP_IV_SIZE);
+    kuz_kexp15(&omac, &enc, ivs + i*KUZ_KEXP_IV_SIZE, key, wrapped + i*KUZ_KEXP_SIZE);
+  }
+  ok &= kuz_kimp15(&omac, &enc, ivs, wrapped, out) == 0 && memcmp(out, key, KUZ_KEY_SIZE) == 0;
+
+  // A flipped bit of the second key : rejected and zeroed, alone and in a batch
+  wrapped[KUZ_KEXP_SIZE + 5] ^= 1;
+  ok &= kuz_kimp15(&omac, &enc, ivs + KUZ_KEXP_IV_SIZE, wrapped + KUZ_KEXP_SIZE, out) == -1;
+  for(i=0;i<KUZ_KEY_SIZE;i++)
+  {
+    ok &= out[i] == 0;
+  }
+  ok &= kuz_kimp15_batch(&omac, &enc, ivs, wrapped, keys, 3) == 1;
+  ok &= memcmp(keys, key, KUZ_KEY_SIZE) == 0 && memcmp(keys + 2*KUZ_KEY_SIZE, key, KUZ_KEY_SIZE) == 0;
+  for(i=0;i<KUZ_KEY_SIZE;i++)
+  {
+    ok &= keys[KUZ_KEY_SIZE + i] == 0;
+  }
+  Report("kexp15", ok);
+}
+
+/*****************************************************************************/
+/* R 1323565.1.026-2019                                                      */
+/*****************************************************************************/
+
+static void TestMgm(const kuz_ctx_t* ctx)
+{
+  static const char* nonce = "1122334455667700ffeeddccbbaa9988";
+  static const char* aad =
+    "0202020202020202010101010101010104040404040404040303030303030303ea0505050505050505";
+  static const char* pt =
+    "1122334455667700ffeeddccbbaa998800112233445566778899aabbcceeff0a"
+    "112233445566778899aabbcceeff0a002233445566778899aabbcceeff0a0011aabbcc";
+  static const char* ct =
+    "a9757b8147956e9055b8a33de89f42fc8075d2212bf9fd5bd3f7069aadc16b39"
+    "497ab15915a6ba85936b5d0ea9f6851cc60c14d4d3f883d0ab94420695c76deb2c7552";
+  static const char* tag = "cf5d656f40c34f5c46e8bb0e29fcdb4c";
+  uint8_t n[KUZ_MGM_NONCE_SIZE], a[MAX_MSG], p[MAX_MSG], c[MAX_MSG], t[KUZ_MGM_TAG_SIZE];
+  size_t alen, plen, piece, done, k;
+  kuz_mgm_t st;
+  int ok;
+
+  Hex(nonce, n);
+  alen = Hex(aad, a);
+  plen = Hex(pt, p);
+
+  kuz_mgm_init(&st, ctx, n);
+  ok = kuz_mgm_aad(&st, a, alen) == 0;
+  kuz_mgm_encrypt(&st, p, c, plen);
+  kuz_mgm_final(&st, t, sizeof(t));
+  ok &= Equal(c, ct, plen) && Equal(t, tag, sizeof(t));
+
+  for(piece=1;piece<=17;piece++)
+  {
+    kuz_mgm_init(&st, ctx, n);
+    for(done=0;done<alen;done+=k)
+    {
+      k = alen - done < piece ? alen - done : piece;
+      kuz_mgm_aad(&st, a + done, k);
+    }
+    for(done=0;done<plen;done+=k)
+    {
+      k = plen - done < piece ? plen - done : piece;
+      kuz_mgm_encrypt(&st, p + done, c + done, k);
+    }
+    kuz_mgm_final(&st, t, sizeof(t));
+    ok &= Equal(c, ct, plen) && Equal(t, tag, sizeof(t));
+  }
+
+  // Decryption : the tag accepted, then rejected with one bit of C flipped
+  kuz_mgm_init(&st, ctx, n);
+  kuz_mgm_aad(&st, a, alen);
+  kuz_mgm_decrypt(&st, c, p, plen);
+  ok &= kuz_mgm_verify(&st, t, sizeof(t)) == 0 && Equal(p, pt, plen);
+
+  c[plen - 1] ^= 0x80;
+  kuz_mgm_init(&st, ctx, n);
+  kuz_mgm_aad(&st, a, alen);
+  kuz_mgm_decrypt(&st, c, p, plen);
+  ok &= kuz_mgm_verify(&st, t, sizeof(t)) == -1;
+  Report("mgm", ok);
+}
+
+/*****************************************************************************/
+/* Main                                                                      */
+/*****************************************************************************/
+
+int main(void)
+{
+  uint8_t key[KUZ_KEY_SIZE], pt[7*KUZ_BLOCK_SIZE];
+  kuz_ctx_t ctx;
+#ifdef KUZNYECHIK_SIMD
+  const char* force = getenv("KUZ_X86_KERNEL");
+#endif
+
+  Hex(testKey, key);
+  Hex(testPt, pt);
+  kuz_ctx_init(&ctx, key);
+#ifdef KUZNYECHIK_SIMD
+  // The makefile runs this once per kernel, forced through KUZ_X86_KERNEL
+  if(force != NULL && strcmp(force, kuz_x86_engine()) != 0)
+  {
+    printf("%s: kernel %s not supported by this CPU, skipped\n", ENGINE_NAME, force);
+    return 0;
+  }
+  snprintf(engine, sizeof(engine), "%s/%s", ENGINE_NAME, kuz_x86_engine());
+#endif
+
+  TestEcb(&ctx, pt);
+  TestCtr(&ctx, pt);
+  TestFeedback(&ctx, pt);
+  TestMac(&ctx, pt);
+  TestAcpkm(&ctx, pt);
+  TestKexp();
+  TestMgm(&ctx);
+
+  if(failed)
+  {
+    fprintf(stderr, "%s: known-answer tests FAILED\n", engine);
+  }
+  return failed;
+}